@@ -3,12 +3,14 @@
 #include "../common/Player.h"
 #include "../common/SatelliteView.h"
 #include "../UserCommon/UC_include/ExtBattleInfo.h"
+#include "../UserCommon/UC_include/DeltaSatelliteView.h"
 #include <vector>
 #include <utility>
 #include <memory>
 #include <map>
+#include <set>
 
-using std::map ,std::vector, std::unique_ptr, std::make_unique, std::pair;
+using std::map ,std::vector, std::unique_ptr, std::make_unique, std::pair, std::set;
 
 namespace Algorithm_209277367_322542887 {
     struct TankStatus{
@@ -27,9 +29,10 @@ namespace Algorithm_209277367_322542887 {
         ~Player_209277367_322542887() override = default; // Destructor
 
     protected:
-        // Function to initiate gameboard, shells locations and tank locations based on satellite view
-        void initGameboardAndShells(vector<vector<char>>& gameboard, vector<pair<int,int>>& shells_location, SatelliteView &satellite_view,
+        // Function to update gameboard_, and get shells locations and tank location, based on satellite view
+        void initGameboardAndShells(vector<pair<int,int>>& shells_location, SatelliteView &satellite_view,
             pair<int, int>& tank_location);
+        void updateCell(int x, int y, char obj); // Function to update one cell of gameboard_ and shells_
 
         // Function to update tank with battle info
         void updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) override;
@@ -40,6 +43,9 @@ namespace Algorithm_209277367_322542887 {
         size_t maxSteps_;
         size_t numShells_;
         map<int, TankStatus> tankStatus_;
+        vector<vector<char>> gameboard_; // Board from the latest satellite view
+        set<pair<int, int>> shells_; // Shells on gameboard_ as (y, x), in row-major order
+        pair<int, int> selfLocation_; // Cell shown as '%' on gameboard_
 
     };
 }
\ No newline at end of file
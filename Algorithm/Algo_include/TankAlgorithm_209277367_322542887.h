@@ -4,6 +4,7 @@
 #include "../common/ActionRequest.h"
 #include "../common/BattleInfo.h"
 #include "../../UserCommon/UC_include/Direction.h"
+#include "../../UserCommon/UC_include/NeighborTable.h"
 #include <utility>
 #include <queue>
 #include <stack>
@@ -34,12 +35,13 @@ namespace Algorithm_209277367_322542887 {
         bool justMovedBackwardsFlag_;
         int backwardsTimer_;
         bool justGotBattleinfo_; //DEBUGMODE
-        bool firstBattleinfo_; //DEBUGMODE
+        bool firstBattleinfo_; // No BattleInfo received yet
         Direction shotDir_;
         int shotDirCooldown_{};
 
         vector<vector<char>> gameboard;
         vector<pair<int,int>> shellLocations_;
+        shared_ptr<const NeighborTable> neighbors_; // Wrap-around neighbors for the current board size
 
         static Direction diffToDir(int diff_x, int diff_y, int rows = INF, int cols = INF);
         void evadeShell(Direction danger_dir, const vector<vector<char>>& gameboard);
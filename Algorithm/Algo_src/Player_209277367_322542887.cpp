@@ -12,15 +12,14 @@ Player_209277367_322542887::Player_209277367_322542887(const int player_index, c
 
 // Function to update tank with battle info
 void Player_209277367_322542887::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
-    vector<vector<char>> gameboard;
     vector<pair<int, int>> shells_location;
     pair<int, int> tank_location;
 
-    // Initialize the gameboard with satellite_view and gather shell locations
-    initGameboardAndShells(gameboard, shells_location, satellite_view, tank_location);
+    // Update the gameboard with satellite_view and gather shell locations
+    initGameboardAndShells(shells_location, satellite_view, tank_location);
 
     // Create a new battle info object
-    const unique_ptr<BattleInfo> battleInfo = make_unique<ExtBattleInfo>(gameboard, shells_location, numShells_, tank_location);
+    const unique_ptr<BattleInfo> battleInfo = make_unique<ExtBattleInfo>(gameboard_, shells_location, numShells_, tank_location);
 
     // Update tank with battle info -
     // If it's the first time the tank receives battle info, initialize the tank's ammo and location
@@ -34,27 +33,44 @@ void Player_209277367_322542887::updateTankWithBattleInfo(TankAlgorithm& tank, S
 }
 
 
-// Function to init gameboard and shell locations based on the satellite_view
-void Player_209277367_322542887::initGameboardAndShells(vector<vector<char>>& gameboard, vector<pair<int,int>>& shells_location, SatelliteView &satellite_view,
+// Function to update the gameboard and get shell locations based on the satellite_view.
+// A DeltaSatelliteView lists the cells changed since our previous view, so only those are read;
+// any other view is read in full.
+void Player_209277367_322542887::initGameboardAndShells(vector<pair<int,int>>& shells_location, SatelliteView &satellite_view,
         pair<int, int>& tank_location) {
 
-    gameboard.resize(y_, vector<char>(x_, ' ')); // Resize the gameboard to match satellite_view
-
-    // Iterate over the satellite_view and update the gameboard
-    for (int i = 0; i < y_; ++i){
-        for (int j = 0; j < x_; ++j){
-            const char obj = satellite_view.getObjectAt(j, i);
-            gameboard[i][j] = obj; // Update the gameboard with the object from satellite_view
-
-            if (obj == '*') { // Found shell
-                shells_location.emplace_back(j, i);
-            }
-
-            else if (obj == '%') { // Found self
-                tank_location = {j, i};
+    const auto* delta = dynamic_cast<const DeltaSatelliteView*>(&satellite_view);
+    if (delta != nullptr && delta->hasChanges() && !gameboard_.empty()) {
+        const size_t width = delta->getWidth();
+        for (const size_t cell : delta->getChangedCells()) {
+            const int x = static_cast<int>(cell % width);
+            const int y = static_cast<int>(cell / width);
+            updateCell(x, y, satellite_view.getObjectAt(x, y));
+        }
+    } else {
+        gameboard_.assign(y_, vector<char>(x_, ' ')); // Resize the gameboard to match satellite_view
+        shells_.clear();
 
+        // Iterate over the satellite_view and update the gameboard
+        for (int i = 0; i < y_; ++i){
+            for (int j = 0; j < x_; ++j){
+                updateCell(j, i, satellite_view.getObjectAt(j, i));
             }
         }
     }
+
+    // Shells in row-major order, as a full scan finds them
+    shells_location.reserve(shells_.size());
+    for (const auto& [y, x] : shells_) { shells_location.emplace_back(x, y); }
+    tank_location = selfLocation_;
 }
 
+// Function to update one cell of the gameboard and the shell set
+void Player_209277367_322542887::updateCell(const int x, const int y, const char obj) {
+    gameboard_[y][x] = obj; // Update the gameboard with the object from satellite_view
+
+    if (obj == '*') { shells_.emplace(y, x); } // Found shell
+    else { shells_.erase({y, x}); }
+
+    if (obj == '%') { selfLocation_ = {x, y}; } // Found self
+}
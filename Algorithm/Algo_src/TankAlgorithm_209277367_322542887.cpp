@@ -49,7 +49,7 @@ Direction TankAlgorithm_209277367_322542887 :: diffToDir(const int diff_x, const
     if (diff_x > 0 && diff_y > 0) dir = Direction::UL;
 
     // Update direction based on the pass value
-    dir = static_cast<Direction>((static_cast<int>(dir) + pass) % 8);
+    dir = rotateDirection(dir, pass);
 
     return dir;
 }
@@ -67,15 +67,14 @@ void TankAlgorithm_209277367_322542887 :: evadeShell(Direction danger_dir, const
     const int cols = static_cast<int>(gameboard[0].size()); // X-axis
 
     // Get the opposite direction of the shell
-    const auto opposite_danger_dir = static_cast<Direction>((static_cast<int>(danger_dir) + 4) % 8);
+    const auto opposite_danger_dir = oppositeDirection(danger_dir);
 
-    for (int i = 0; i < 8; i++) { // Iterate through all directions
+    for (int i = 0; i < DIRECTION_COUNT; i++) { // Iterate through all directions
         auto curr_dir = static_cast<Direction>(i);
         if (curr_dir == danger_dir || curr_dir == opposite_danger_dir) {continue;} // Skip the direction of the shell
 
         // Calculate the new coordinates based on the current direction
-        int new_x = (location_.first + directionMap.at(static_cast<Direction>(i)).first + cols) % cols;
-        int new_y = (location_.second + directionMap.at(static_cast<Direction>(i)).second + rows) % rows;
+        auto [new_x, new_y] = neighbors_->next(location_.first, location_.second, curr_dir);
 
         if (gameboard[new_y][new_x] == ' ') { // Check if the cell is empty
             bool curr_backwards_flag = backwardsFlag_;
@@ -111,7 +110,7 @@ optional<Direction> TankAlgorithm_209277367_322542887 :: actionsToNextCell(const
         if (is_evade) { // If evading
             turnsToEvade_ = 2;
         }
-        return static_cast<Direction>((static_cast<int>(dir) - 1 + 8 ) % 8);
+        return rotateDirection(dir, -1);
 
     case 2: // Move left
         actionsQueue_.push(ActionRequest::RotateLeft90);
@@ -120,7 +119,7 @@ optional<Direction> TankAlgorithm_209277367_322542887 :: actionsToNextCell(const
         if (is_evade) { // If evading
             turnsToEvade_ = 2;
         }
-        return static_cast<Direction>((static_cast<int>(dir) - 2 + 8 ) % 8);
+        return rotateDirection(dir, -2);
 
     case 3: // Move left-backward
         actionsQueue_.push(ActionRequest::RotateLeft90);
@@ -130,7 +129,7 @@ optional<Direction> TankAlgorithm_209277367_322542887 :: actionsToNextCell(const
         if (is_evade) { // If evading
             turnsToEvade_ = 3;
         }
-        return static_cast<Direction>((static_cast<int>(dir) - 3 + 8 ) % 8);
+        return rotateDirection(dir, -3);
 
     case 4: // Move backward
         // If supposed to evade backwards - prefer to shoot
@@ -154,7 +153,7 @@ optional<Direction> TankAlgorithm_209277367_322542887 :: actionsToNextCell(const
         if (is_evade) { // If evading
             turnsToEvade_ = 3;
         }
-        return static_cast<Direction>((static_cast<int>(dir) + 3 + 8 ) % 8);
+        return rotateDirection(dir, 3);
 
     case 6: // Move right
         actionsQueue_.push(ActionRequest::RotateRight90);
@@ -163,7 +162,7 @@ optional<Direction> TankAlgorithm_209277367_322542887 :: actionsToNextCell(const
         if (is_evade) { // If evading
             turnsToEvade_ = 2;
         }
-        return static_cast<Direction>((static_cast<int>(dir) + 2 + 8 ) % 8);
+        return rotateDirection(dir, 2);
 
     case 7: // Move right-forward
         actionsQueue_.push(ActionRequest::RotateRight45);
@@ -172,7 +171,7 @@ optional<Direction> TankAlgorithm_209277367_322542887 :: actionsToNextCell(const
         if (is_evade) { // If evading
             turnsToEvade_ = 2;
         }
-        return static_cast<Direction>((static_cast<int>(dir) + 1 + 8 ) % 8);
+        return rotateDirection(dir, 1);
 
     default: // No direction change
         return std::nullopt;
@@ -251,40 +250,34 @@ void TankAlgorithm_209277367_322542887 :: decreaseTurnsToShoot(const ActionReque
 
 // Update tanks location and orientation based on the action
 void TankAlgorithm_209277367_322542887 :: updateLocation(const ActionRequest action) {
-    // Get gameboard dimensions
-    const int rows = static_cast<int>(gameboard.size()); // Y-axis
-    const int cols = static_cast<int>(gameboard[0].size()); // X-axis
-
     switch(action){ // Switch case over the action
         // For movement - update the location
         case ActionRequest::MoveForward:{
             backwardsFlag_ = false;
             // Move to the next location
-            auto [fst, snd] = directionMap.at(direction_);
-            location_ = {(location_.first + fst + cols) % cols, (location_.second + snd + rows) % rows};
+            location_ = neighbors_->next(location_.first, location_.second, direction_);
             break;
         }
         case ActionRequest::MoveBackward:{
             backwardsFlag_ = true;
             // Move to the next location
-            auto [fst, snd] = directionMap.at(direction_);
-            location_ = {(location_.first - fst + cols) % cols , (location_.second - snd + rows) % rows};
+            location_ = neighbors_->next(location_.first, location_.second, oppositeDirection(direction_));
             break;
         }
 
         // For rotation - update the direction
         case ActionRequest::RotateLeft90:
             // Update the direction
-            direction_ = static_cast<Direction>((static_cast<int>(direction_) - 2 + 8) % 8);
+            direction_ = rotateDirection(direction_, -2);
             break;
         case ActionRequest::RotateRight90:
-            direction_ = static_cast<Direction>((static_cast<int>(direction_) + 2) % 8);
+            direction_ = rotateDirection(direction_, 2);
             break;
         case ActionRequest::RotateLeft45:
-            direction_ = static_cast<Direction>((static_cast<int>(direction_) - 1 + 8) % 8);
+            direction_ = rotateDirection(direction_, -1);
             break;
         case ActionRequest::RotateRight45:
-            direction_ = static_cast<Direction>((static_cast<int>(direction_) + 1) % 8);
+            direction_ = rotateDirection(direction_, 1);
             break;
         // Default for any other action
         default:
@@ -318,6 +311,13 @@ void TankAlgorithm_209277367_322542887 :: updateBattleInfo(BattleInfo& info){
     this->gameboard = battle_info.getGameboard(); // Get the gameboard from the battle info
     this->shellLocations_ = battle_info.getShellsLocation(); // Get the shells locations from the battle info
 
+    // Fetch the shared neighbor table once per board size
+    const int rows = static_cast<int>(gameboard.size());
+    const int cols = rows > 0 ? static_cast<int>(gameboard[0].size()) : 0;
+    if (!neighbors_ || neighbors_->getWidth() != cols || neighbors_->getHeight() != rows) {
+        neighbors_ = NeighborTable::forBoard(cols, rows);
+    }
+
     // Update battle info with the current tank's information
     battle_info.setTankIndex(tankIndex_); // Set the current tank index
     battle_info.setCurrAmmo(ammo_); // Set the current ammo count
@@ -332,19 +332,22 @@ bool TankAlgorithm_209277367_322542887::friendlyInLine(const Direction& dir) con
 
     const int rows = static_cast<int>(gameboard.size());
     const int cols = static_cast<int>(gameboard[0].size());
+    const NeighborTable& neighbors = *neighbors_;
 
     // Get the enemy ID to search in map
     const int enemy_id = playerIndex_ == 1 ? 2 : 1;
 
     const bool is_cardinal_dir = dir == Direction::U || dir == Direction::D || dir == Direction::L || dir == Direction::R;
-    const int diff_x = directionMap.at(dir).first;
-    const int diff_y = directionMap.at(dir).second;
+    const auto [diff_x, diff_y] = directionOffset(dir);
 
     // Search for friendly tanks in the line of fire
     if (is_cardinal_dir) {
+        const int tank_cell = neighbors.cellOf(tank_x, tank_y);
+        int cell_id = tank_cell;
         do {
-            x = (x + diff_x + cols) % cols;
-            y = (y + diff_y + rows) % rows;
+            cell_id = neighbors.next(cell_id, dir); // Wraps around the board edges
+            x = neighbors.xOf(cell_id);
+            y = neighbors.yOf(cell_id);
 
             char cell = gameboard[y][x];
             if (cell == '0' + enemy_id) { // Found enemy tank
@@ -353,7 +356,7 @@ bool TankAlgorithm_209277367_322542887::friendlyInLine(const Direction& dir) con
             if (cell == '0' + playerIndex_) { // Found friendly tank
                 return true;
             }
-        } while (x != tank_x || y != tank_y);
+        } while (cell_id != tank_cell);
 
         return true; // The tank it's self is in the line of fire
     }
@@ -383,55 +386,52 @@ bool TankAlgorithm_209277367_322542887::friendlyInLine(const Direction& dir) con
 // Creates pi_graph using BFS algorithm
 // and return a stack of the path from out tank to the closest enemy tank
 stack<pair<int,int>> TankAlgorithm_209277367_322542887::get_path_stack(const vector<vector<char>>& gameboard) const {
-    // Get gameboard dimensions
-    const int rows = static_cast<int>(gameboard.size()); // Y-axis
-    const int cols = static_cast<int>(gameboard[0].size()); // X-axis
+    // Cells are addressed by their id in the shared neighbor table (y * cols + x)
+    const NeighborTable& neighbors = *neighbors_;
 
     // Get the stating location of the tank
-    int x_start = location_.first;
-    int y_start = location_.second;
+    const int start_cell = neighbors.cellOf(location_.first, location_.second);
 
-    vector visited(rows, vector(cols, false)); // Matrix to keep track of visited cells
-    vector pi_graph(rows, vector<pair<int,int>>(cols, {-2, -2})); // Matrix to keep track of the parent of each cell
-    queue<pair<int, int>> bfs_queue; // Queue to store the cells to be visited
+    vector<char> visited(neighbors.cellCount(), false); // Keep track of visited cells
+    vector<int> pi_graph(neighbors.cellCount(), -2); // Keep track of the parent of each cell
+    queue<int> bfs_queue; // Queue to store the cells to be visited
 
-    bfs_queue.emplace(x_start, y_start); // Push the starting cell into the queue
-    visited[y_start][x_start] = true; // Mark the starting cell as visited
-    pi_graph[y_start][x_start] = {-1, -1}; // Starting cell doesn't have a parent
+    bfs_queue.push(start_cell); // Push the starting cell into the queue
+    visited[start_cell] = true; // Mark the starting cell as visited
+    pi_graph[start_cell] = -1; // Starting cell doesn't have a parent
     bool found = false; // Flag to indicate if a target is found
-    pair<int,int> end_cell; // Variable to store the coordinates of the target cell
+    int end_cell = -1; // Variable to store the target cell
 
     // BFS algorithm implementation for finding the closest enemy tank
     while(!bfs_queue.empty()){
 
         // get the current cell from the queue
-        auto [fst, snd] = bfs_queue.front();
+        const int curr_cell = bfs_queue.front();
         bfs_queue.pop();
 
         // Check for each cell around the curr location
-        for (int i = 0; i < 8; i++){
-            int new_x = (fst + directionMap.at(static_cast<Direction>(i)).first + cols) % cols;
-            int new_y = (snd + directionMap.at(static_cast<Direction>(i)).second + rows) % rows;
+        for (int i = 0; i < DIRECTION_COUNT; i++){
+            const int new_cell_id = neighbors.next(curr_cell, static_cast<Direction>(i));
+            const char new_cell = gameboard[neighbors.yOf(new_cell_id)][neighbors.xOf(new_cell_id)];
 
             // Check if the new cell is an enemy tank
-            if (const char new_cell = gameboard[new_y][new_x]; isdigit(new_cell) && new_cell != '0' + playerIndex_){
-                visited[new_y][new_x] = true; // Mark the cell as visited
-                pi_graph[new_y][new_x] = {fst, snd}; // Set the parent of the cell to the current cell
-                end_cell = {new_x, new_y}; // Store the coordinates of the enemy tank
+            if (isdigit(new_cell) && new_cell != '0' + playerIndex_){
+                visited[new_cell_id] = true; // Mark the cell as visited
+                pi_graph[new_cell_id] = curr_cell; // Set the parent of the cell to the current cell
+                end_cell = new_cell_id; // Store the enemy tank's cell
                 found = true; // Mark we found a target
                 break;
             }
 
             // If the new cell is not visited and not a wall or mine, add it to the queue
-            if (!visited[new_y][new_x]){
-                visited[new_y][new_x] = true; // Mark the cell as visited
+            if (!visited[new_cell_id]){
+                visited[new_cell_id] = true; // Mark the cell as visited
                 // If the new cell is a wall or mine, skip it
-                char new_cell = gameboard[new_y][new_x];
                 if (new_cell == '#' || new_cell == '@' || new_cell == '$' || new_cell == '0' + playerIndex_) {
                     continue;
                 }
-                pi_graph[new_y][new_x] = {fst, snd}; // Set the parent of the cell to the current cell
-                bfs_queue.emplace(new_x, new_y); // Add the new cell to the queue
+                pi_graph[new_cell_id] = curr_cell; // Set the parent of the cell to the current cell
+                bfs_queue.push(new_cell_id); // Add the new cell to the queue
             }
         }
 
@@ -448,12 +448,12 @@ stack<pair<int,int>> TankAlgorithm_209277367_322542887::get_path_stack(const vec
 
     // After a target is found, reconstruct the path from the target to the tank
     stack<pair<int,int>> path; // Stack to store the path
-    pair<int,int> curr = end_cell; // Start from the target cell
+    int curr = end_cell; // Start from the target cell
 
     // Reconstruct the path by following the parent cells
-    while (curr != std::make_pair(x_start, y_start)){
-        path.push(curr); // Push the current cell into the stack
-        curr = pi_graph[curr.second][curr.first]; // Move to the parent cell
+    while (curr != start_cell){
+        path.emplace(neighbors.xOf(curr), neighbors.yOf(curr)); // Push the current cell into the stack
+        curr = pi_graph[curr]; // Move to the parent cell
     }
 
     return path;
@@ -482,9 +482,9 @@ ActionRequest TankAlgorithm_209277367_322542887::getAction() {
         justMovedBackwardsFlag_ = true;
     }
 
-    // If the queue is empty and didn't get BattleInfo last turn,
-    // get BattleInfo for next moves
-    if (actionsQueue_.empty() && !justGotBattleinfo_){
+    // If the queue is empty and didn't get BattleInfo last turn, or never got any
+    // (the request was not answered), get BattleInfo for next moves
+    if (actionsQueue_.empty() && (!justGotBattleinfo_ || firstBattleinfo_)){
         actionsQueue_.push(ActionRequest::GetBattleInfo);
         justGotBattleinfo_ = true;
     }
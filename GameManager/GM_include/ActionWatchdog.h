@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../common/TankAlgorithm.h"
+
+using std::unique_ptr, std::shared_ptr, std::vector;
+
+namespace GameManager_209277367_322542887 {
+
+uint64_t threadCpuNanoseconds(); // CPU time used by the calling thread
+
+// Runs TankAlgorithm::getAction() calls on runner threads and waits for each with a wall-clock
+// limit, so a call that never returns cannot hang the game. A runner whose call returned in time
+// takes the next call. When the limit passes, the caller stops waiting: the runner is detached
+// and takes the algorithm with it, destroying it if the call ever returns, so the abandoned call
+// touches nothing the game manager owns. It still runs this library's code and the algorithm's,
+// so neither may be unloaded while it can be running. Thread safe - the parallel callback phase
+// makes several calls at once.
+class ActionWatchdog {
+    struct Runner; // A thread and the call handed to it, shared by the watchdog and the thread
+
+    std::mutex mutex_;
+    vector<shared_ptr<Runner>> idle_; // Runners waiting for a call
+
+    static void runnerLoop(shared_ptr<Runner> runner);
+
+    public:
+        // Rule of 5
+        ActionWatchdog() = default;
+        ActionWatchdog(const ActionWatchdog&) = delete;
+        ActionWatchdog& operator=(const ActionWatchdog&) = delete;
+        ActionWatchdog(ActionWatchdog&&) noexcept = delete;
+        ActionWatchdog& operator=(ActionWatchdog&&) noexcept = delete;
+        ~ActionWatchdog(); // Stops and joins the idle runners; abandoned calls finish on their own
+
+        // Call algorithm->getAction(), waiting at most limit. Returns true with the action and the
+        // call's CPU time (on the runner's clock), rethrowing what the call threw; or false, with
+        // DoNothing and 0, once the limit passed - algorithm is then moved into the abandoned call.
+        bool call(unique_ptr<TankAlgorithm>& algorithm, std::chrono::nanoseconds limit, ActionRequest& action,
+            uint64_t& cpu_nanoseconds);
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+using std::vector, std::size_t;
+
+namespace GameManager_209277367_322542887 {
+
+// For one player: the cells of the start-of-turn snapshot that may have changed since the
+// player's previous battle info, handed out with the next DeltaSatelliteView. Each cell is
+// listed once, so the list never outgrows the board.
+class BattleInfoDelta {
+    vector<char> listed_; // Per cell: in cells_
+    vector<size_t> cells_;
+    size_t lastOverlay_ = 0; // Cell shown as '%' in the previous view
+    bool primed_ = false; // The player has a view to apply changes to
+
+    public:
+        // Methods are defined inline - add() runs for every changed snapshot cell
+        void reset(const size_t cells) { // Forget the previous view - the next one is read in full
+            listed_.assign(cells, false);
+            cells_.clear();
+            primed_ = false;
+        }
+
+        void add(const size_t cell) {
+            if (primed_ && !listed_[cell]) {
+                listed_[cell] = true;
+                cells_.push_back(cell);
+            }
+        }
+
+        bool primed() const { return primed_; }
+
+        // Changes for a view overlaid at cell overlay, nullptr if it must be read in full
+        const vector<size_t>* changesFor(const size_t overlay) {
+            if (!primed_) { return nullptr; }
+            add(lastOverlay_);
+            add(overlay);
+            return &cells_;
+        }
+
+        void delivered(const size_t overlay) { // The player now has the view overlaid at overlay
+            for (const size_t cell : cells_) { listed_[cell] = false; }
+            cells_.clear();
+            lastOverlay_ = overlay;
+            primed_ = true;
+        }
+};
+
+} // namespace GameManager_209277367_322542887
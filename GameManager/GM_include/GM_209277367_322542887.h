@@ -1,11 +1,16 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <set>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 #include <mutex>
 #include <filesystem>
 
@@ -14,47 +19,114 @@
 #include "../../common/TankAlgorithm.h" // FIX
 #include "../common/SatelliteView.h"
 #include "../common/Player.h"
-#include "TankInfo.h"
-#include "../UserCommon/UC_include/Shell.h"
+#include "TankTable.h"
+#include "OccupancyGrid.h"
+#include "ShellPool.h"
+#include "GameLogWriter.h"
+#include "ReplayRecorder.h"
+#include "GameState.h"
+#include "TaskPool.h"
+#include "BattleInfoDelta.h"
+#include "ZobristHash.h"
+#include "ShellBitboard.h"
+#include "PhaseTimer.h"
+#include "ActionWatchdog.h"
 #include "../common/ActionRequest.h"
 #include "../../common/SatelliteView.h"
 #include "../../common/ActionRequest.h"
 #include "../UserCommon/UC_include/ExtSatelliteView.h"
+#include "../UserCommon/UC_include/DeltaSatelliteView.h"
+#include "../UserCommon/UC_include/Gameboard.h"
+#include "../UserCommon/UC_include/NeighborTable.h"
+#include "../UserCommon/UC_include/ExtGameResult.h"
+#include "../UserCommon/UC_include/ReusableGameManager.h"
+#include "../UserCommon/UC_include/BudgetedGameManager.h"
 
-using std::unique_ptr, std::string, std::vector, std::ifstream, std::ofstream, std::set, std::cout, std::endl, std::move;
-using TankIterator = std::vector<std::unique_ptr<TankInfo>>::iterator;
-using ShellIterator = std::vector<std::unique_ptr<Shell>>::iterator;
+using std::unique_ptr, std::array, std::string, std::vector, std::ifstream, std::ofstream, std::set, std::cout, std::endl, std::move;
 using namespace UserCommon_209277367_322542887;
 namespace fs = std::filesystem;
 
 namespace GameManager_209277367_322542887 {
-    class GM_209277367_322542887 : public AbstractGameManager {
+    class GM_209277367_322542887 : public AbstractGameManager, public ExtGameResultSource,
+        public ReusableGameManager, public BudgetedGameManager {
 
     public:
         explicit GM_209277367_322542887(bool verbose); // Constructor
         GM_209277367_322542887& operator=(const GM_209277367_322542887&) = delete; // Copy assignment
         GM_209277367_322542887(GM_209277367_322542887&&) noexcept = delete; // Move constructor
         GM_209277367_322542887& operator=(GM_209277367_322542887&&) noexcept = delete; // Move assignment
-        ~GM_209277367_322542887() = default; // Destructor
+        ~GM_209277367_322542887() override; // Destructor - waits for the logs it handed to GameLogWriter
 
         GameResult run(size_t map_width, size_t map_height, const SatelliteView& map, string map_name,
             size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
             TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) override;
         pair<int, int> getGameboardSize() const;
 
+        // Turn-by-turn control - run() is startGame(), playTurn() until it returns false, finishGame()
+        void startGame(size_t map_width, size_t map_height, const SatelliteView& map, string map_name,
+            size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
+            TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory);
+        bool playTurn(); // Play one turn, false once the game is over
+        GameResult finishGame(); // Write out the log and replay, return the result
+        void reset() override; // Forget the last game, keeping the buffers and the settings
+        bool isGameOver() const { return gameOver_; }
+        int getTurn() const { return turn_; }
+        const Gameboard& getGameboard() const { return gameboard_; }
+
+        // Game state between turns, for checkpoints and forking a position into several continuations
+        void saveState(GameState& state) const; // Copy the state into state, reusing its storage
+        bool restoreState(const GameState& state); // Continue from a state saved in the same game
+
+        // Zobrist hash of the board, tanks and shells, kept up to date on every change
+        uint64_t getStateHash() const { return stateHash_.value(); } // After the last turn played, or at game end
+        uint64_t computeStateHash() const; // The same hash computed from scratch, O(board)
+
         void setVisualMode(bool visual_mode); // Visualisation
+        void setReplayFile(const string& path); // Record the next game as a binary replay ("" to stop)
+        void setReplayDir(const string& dir); // Archive every game's replay to dir ("" to stop)
+        void setCallbackThreads(size_t threads); // Threads for the tank and player callbacks (<= 1 for serial)
+        void setCycleWindow(size_t turns); // End the game once a cycle of up to turns turns repeats (0 to stop)
+        void setShellBitboard(bool enabled); // Advance shells with bit planes on boards that fit
+        void setActionBudget(uint64_t call_microseconds, uint64_t game_milliseconds,
+            uint64_t timeout_milliseconds) override; // getAction() budgets and time limit (0 for none)
+
+        // Per-phase timings (in builds with ENABLE_GM_PROFILE) and budget overruns of the last game
+        const ExtGameResult& getExtGameResult() const override { return extGameResult_; }
 
     private:
         function<std::unique_ptr<TankAlgorithm>(int, int)> player1TankFactory_; // Factory for creating tank algorithms
         function<std::unique_ptr<TankAlgorithm>(int, int)> player2TankFactory_;
         Player* player1_; // Player 1
         Player* player2_; // Player 2
-        vector<vector<char>> gameboard_; // Game board represented as a 2D vector
-        vector<unique_ptr<TankInfo>> tanks_;
-        set<size_t> destroyedTanksIndices_; // Set of tank indices to delete
-        vector<unique_ptr<Shell>> shells_; // Shells fired by tanks
-        ofstream gameLog_; // Log file for game events
-        GameResult gameResult_;
+        Gameboard gameboard_; // Game board stored contiguously in row-major order
+        Gameboard spareBoard_; // Sized with gameboard_, takes its place when finishGame() hands it to the result
+        shared_ptr<const NeighborTable> neighbors_; // Wrap-around neighbors of every cell
+        TankTable tanks_; // Tank columns and the live tank list
+        array<size_t, 2> aliveTanks_{}; // Per player: alive tanks
+        array<size_t, 2> outOfAmmoTanks_{}; // Per player: alive tanks with no ammo left
+        ShellPool shells_; // Shells fired by tanks
+        OccupancyGrid shellGrid_; // Per cell: lowest shells_ slot located there
+        vector<unsigned> shellCountStampAt_; // Per cell: checkShellsCollide pass that last reset shellCount_
+        vector<int> shellCount_; // Per cell: shells counted in the current checkShellsCollide pass
+        unsigned shellCountStamp_ = 0; // Current checkShellsCollide pass
+        vector<int> shellSurvivors_; // Scratch: slots kept by checkShellsCollide
+        vector<int> shellFrom_; // Scratch, per slot: cells of the shell paths in advanceOpenShells
+        vector<int> shellVia_;
+        vector<int> shellTo_;
+        OccupancyGrid tankGrid_; // Per cell: lowest tanks_ index located there (alive tanks only)
+        ZobristHash stateHash_; // Hash of gameboard_, the alive tanks and the shells
+        bool openShellKernel_ = true; // Fused open-space kernel allowed (the tests turn it off to compare with the rules)
+        bool shellBitboardEnabled_ = false; // Bit-plane shell backend requested
+        bool useShellBitboard_ = false; // Bit-plane shell backend active for the current game
+        int shellBitboardMinShells_ = ShellBitboard::MIN_SHELLS; // Fewest shells for a bit-plane half step (the tests lower it)
+        ShellBitboard shellBitboard_; // Bit planes of gameboard_, kept in sync by setCell when active
+        std::ostringstream gameLog_; // Verbose log of the game, written out when the game ends
+        ofstream gameLogFile_; // Verbose log file, opened when the game starts
+        bool submittedLogs_ = false; // A log or replay was handed to GameLogWriter
+        GameResult gameResult_; // Its gameState is only set by finishGame()
+        bool resultReady_ = false; // The game ended with a result - finishGame() moves gameboard_ into it
+        ExtGameResult extGameResult_; // What the game reports beyond gameResult_
+        PhaseTimer phaseTimer_; // Charges the turn loop to extGameResult_ phases (no-op unless profiling)
         int numShells_{}; // Number of shells for each tank
         int maxSteps_{}; // Maximum steps for the game
         bool gameOver_{}; // Flag to indicate if the game is over
@@ -67,47 +139,98 @@ namespace GameManager_209277367_322542887 {
         size_t numTanks1_ = 0;
         size_t numTanks2_ = 0;
         bool verbose_ = false;
-        vector<vector<char>> lastRoundGameboard_;
+        Gameboard lastRoundGameboard_; // Snapshot of the board at the start of the turn, synced lazily
+        vector<bool> dirtyRows_; // Rows of gameboard_ that may differ from lastRoundGameboard_
+        vector<int> dirtyRowList_; // Indices of the dirty rows
+        vector<pair<size_t, char>> turnJournal_; // (cell index, old symbol) written during the action phase
+        bool journalWrites_ = false; // Whether setCell journals overwritten cells
+        int snapshotTurn_ = -1; // Turn for which lastRoundGameboard_ was last synced
         vector<pair<ActionRequest, bool>> tankActions_;
+        uint64_t actionBudgetNs_ = 0; // CPU budget of one getAction() call, 0 for none
+        uint64_t gameBudgetNs_ = 0; // CPU budget of all getAction() calls of a player in a game, 0 for none
+        uint64_t actionTimeoutNs_ = 0; // Wall time after which a getAction() call is abandoned, 0 for none
+        vector<uint64_t> actionCpuNs_; // Per tank: CPU time of its getAction() call this turn
+        vector<char> actionTimedOut_; // Per tank: its getAction() call this turn was abandoned (char, as threads write it)
+        unique_ptr<ActionWatchdog> watchdog_; // Makes the getAction() calls while actionTimeoutNs_ is set
+        size_t callbackThreads_ = 1; // Threads for the callback phase, 1 for serial
+        unique_ptr<TaskPool> callbackPool_; // Workers for the callback phase, if parallel
+        vector<pair<int, pair<int, int>>> battleInfoRequests_; // Parallel mode: (tank index, location) to deliver this turn
+        array<BattleInfoDelta, 2> battleInfoDeltas_; // Per player: snapshot changes since its previous battle info
+        size_t cycleWindow_ = 0; // Longest cycle detected, 0 when detection is off
+        std::unordered_map<uint64_t, int> cycleLastSeen_; // Per turn key: last turn it was seen
+        int cyclePeriod_ = 0; // Distance to the previous occurrence of the last turn's key
+        int cycleMatches_ = 0; // Consecutive turns that repeated the turn cyclePeriod_ turns earlier
+        GameState cycleStart_; // State at the start of the candidate cycle, compared before ending the game
+        vector<pair<ActionRequest, bool>> cycleStartActions_; // tankActions_ at the start of the candidate cycle
+        ReplayRecorder replay_; // Binary replay of the current game, if recording
+        string replayFile_; // Replay output file set through setReplayFile
+        string replayPath_; // Replay output file of the current game, empty if not recording
+        string replayDir_; // Directory to archive every game's replay to (from the environment or setReplayDir)
 
         // bool visualMode_; // Visualisation
 
         // Base functions
         void getTankActions();
-        bool performAction(ActionRequest action, TankInfo& tank);
+        void chargeActionBudgets(); // Apply the budgets to the actions collected by getTankActions
+        void deliverBattleInfo();
+        bool performAction(ActionRequest action, int tank_index);
         void performTankActions();
         void checkTanksStatus();
-        void moveShells(vector<unique_ptr<Shell>>& shells);
+        void moveShells();
         void checkShellsCollide();
+        void compactShellsInCellOrder();
+        void advanceShells();
+        bool advanceOpenShells(int half_steps);
+        bool advanceShellsWithBitboard();
         int getTankIndexAt(int x, int y) const;
-        bool isValidAction(const TankInfo& tank, ActionRequest action) const;
-        bool isValidShoot(const TankInfo& tank) const;
-        bool isValidMove(const TankInfo& tank, ActionRequest action) const;
-        void shoot(TankInfo& tank);
-        void moveTank(TankInfo& tank, ActionRequest action);
-        void rotate(TankInfo& tank, ActionRequest action);
-        ShellIterator getShellAt(int x, int y);
-        ShellIterator deleteShell(ShellIterator it);
+        int nextTankIndexAt(int x, int y, int from) const;
+        void relocateTank(int tank_index, int x, int y);
+        void killTank(int tank_index);
+        bool isValidAction(int tank_index, ActionRequest action) const;
+        bool isValidShoot(int tank_index) const;
+        bool isValidMove(int tank_index, ActionRequest action) const;
+        void shoot(int tank_index);
+        void moveTank(int tank_index, ActionRequest action);
+        void rotate(int tank_index, ActionRequest action);
+        int getShellAt(int x, int y) const;
+        int deleteShell(int slot);
+        int spawnShell(int x, int y, Direction dir);
+        void moveShellTo(int slot, int x, int y);
+        void setShellAboveMine(int slot, bool above);
+        void toggleTankHash(int tank_index);
+        void toggleShellHash(int slot);
+        int nextShellSlotAt(int x, int y, int from) const;
 
         // Support functions
         pair<int, int> nextLocation(int x, int y, Direction dir, bool backwards = false) const;
+        void setCell(int x, int y, char symbol);
+        void resetSnapshot();
+        Gameboard& syncLastRoundGameboard();
+        void resetBattleInfoDeltas();
+        void sendBattleInfo(Player& player, int tank_index, pair<int, int> location);
         void printBoard() const;
         static string getEnumName(Direction dir);
         static string getEnumName(ActionRequest action) ;
-        void updateGameLog();
-        void updateGameResult(int winner, int reason, vector<size_t> remaining_tanks,
-            vector<vector<char>>& game_state, size_t rounds);
+        template <bool Verbose> void updateGameLog(); // Verbose false: no logging, only the tank bookkeeping
+        void updateGameResult(int winner, int reason, vector<size_t> remaining_tanks, size_t rounds);
         bool initiateGame(const SatelliteView& gameBoard);
-        void handleTankCollisionAt( TankInfo& tank, int old_x, int old_y, int new_x, int new_y, Direction dir, char next_cell);
-        void clearPreviousShellPosition(Shell& shell);
-        bool handleShellSpawnOnTank(Shell& shell, ShellIterator& it);
-        bool handleShellCollision(Shell& shell, int x, int y, Direction dir, ShellIterator& it);
-        void handleShellMoveToNextCell(Shell& shell, int x, int y, char next_cell, ShellIterator& it);
+        void handleTankCollisionAt(int tank_index, int old_x, int old_y, int new_x, int new_y, Direction dir, char next_cell);
+        void clearPreviousShellPosition(int slot);
+        bool handleShellSpawnOnTank(int& slot);
+        bool handleShellCollision(int x, int y, Direction dir, int& slot);
+        void handleShellMoveToNextCell(int x, int y, char next_cell, int& slot);
         void openVerboseLog(const std::string& mapName,
                                             const std::string& player1Name,
                                             const std::string& player2Name,
                                             size_t maxSteps,
                                             size_t numShells);
         void closeVerboseLog();
+        void recordReplayTurn();
+        uint64_t turnKey() const;
+        void resetCycleDetection();
+        bool repeatsCycleStart() const;
+        void detectCycle(); // Sets gameOverStatus_ 4 once the last turns repeat a cycle
+        template <bool Verbose> bool playTurn(); // playTurn() specialized for verbose or silent games
+        void writeReplay(const string& path);
     };
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using std::ofstream, std::string, std::size_t;
+
+namespace GameManager_209277367_322542887 {
+
+// Background writer for the verbose game logs (and binary replays).
+// Each game builds its whole log in memory and submits it together with the already opened
+// output file when the game ends; a single worker thread writes the submitted logs in batches
+// and closes the files. Pending logs are written before the writer is destroyed; a game manager
+// waits with flush() when it is destroyed, and Replay::load before reading a replay.
+class GameLogWriter {
+    struct Job {
+        ofstream file;
+        string contents;
+    };
+
+    static constexpr size_t MAX_PENDING_BYTES = 64 * 1024 * 1024; // Submitters wait above this
+
+    std::mutex mutex_;
+    std::condition_variable jobsReady_; // Signalled when a job is submitted or the writer stops
+    std::condition_variable jobsDone_; // Signalled when a batch has been written
+    std::deque<Job> jobs_;
+    size_t pendingBytes_ = 0; // Bytes submitted but not yet written
+    bool stopping_ = false;
+    std::thread worker_;
+
+    GameLogWriter(); // Use get()
+    void workerLoop();
+
+    public:
+        // Rule of 5
+        GameLogWriter(const GameLogWriter&) = delete;
+        GameLogWriter& operator=(const GameLogWriter&) = delete;
+        GameLogWriter(GameLogWriter&&) noexcept = delete;
+        GameLogWriter& operator=(GameLogWriter&&) noexcept = delete;
+        ~GameLogWriter(); // Writes every pending log, then stops the worker
+
+        static GameLogWriter& get(); // Process-wide writer, started on first use
+
+        void submit(ofstream file, string contents); // Queue contents to be written to file, which is then closed
+        void flush(); // Block until every submitted log is on disk
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "TankTable.h"
+#include "OccupancyGrid.h"
+#include "ShellPool.h"
+#include "../common/GameResult.h"
+#include "../UserCommon/UC_include/Gameboard.h"
+
+using std::array, std::vector, std::size_t;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// Everything needed to continue a game from the end of a turn, saved by
+// GM_209277367_322542887::saveState and applied by restoreState. Every member is a flat value
+// or vector, so saving into a reused GameState only copies memory.
+// Tank algorithms and players are not part of the state - a restored game keeps asking the
+// current instances for actions.
+struct GameState {
+    Gameboard board;
+    TankTable::State tanks; // Tank columns and the live tank list
+    array<size_t, 2> aliveTanks{};
+    array<size_t, 2> outOfAmmoTanks{};
+    ShellPool shells;
+    OccupancyGrid shellGrid;
+    OccupancyGrid tankGrid;
+    int turn = 0;
+    bool gameOver = false;
+    bool noAmmoFlag = false;
+    size_t gameOverStatus = 0;
+    size_t noAmmoTimer = 0;
+    size_t numTanks1 = 0;
+    size_t numTanks2 = 0;
+    uint64_t hash = 0; // GM_209277367_322542887::getStateHash
+
+    // Result fields, valid once the game is over (the final board is board)
+    bool hasResult = false;
+    int winner = 0;
+    GameResult::Reason reason = GameResult::ALL_TANKS_DEAD;
+    vector<size_t> remainingTanks;
+    size_t rounds = 0;
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+using std::vector, std::size_t;
+
+namespace GameManager_209277367_322542887 {
+
+// Per-cell index of the entities (shells or tanks) located on the board.
+// Every cell keeps the lowest slot located there and how many slots share it, so a lookup
+// returns the same entity a front-to-back scan of the owning container would find first.
+class OccupancyGrid {
+    vector<int> head_; // Lowest slot located in the cell, -1 if none
+    vector<int> count_; // Number of slots located in the cell
+
+    public:
+        // Methods are defined inline - they run on every spawn, move and lookup
+        void assign(const size_t cells) { // Empty grid of the given number of cells
+            head_.assign(cells, -1);
+            count_.assign(cells, 0);
+        }
+
+        int at(const size_t cell) const { return head_[cell]; } // Lowest slot in the cell, -1 if none
+
+        void add(const size_t cell, const int slot) { // Register slot as located in cell
+            if (count_[cell]++ == 0 || slot < head_[cell]) { head_[cell] = slot; }
+        }
+
+        // Unregister slot from cell. If other slots remain and slot was the head, next_slot(slot)
+        // must return the next lowest slot located in the cell (shared cells are rare and short-lived)
+        template <typename NextSlot>
+        void remove(const size_t cell, const int slot, NextSlot next_slot) {
+            if (--count_[cell] == 0) { head_[cell] = -1; }
+            else if (head_[cell] == slot) { head_[cell] = next_slot(slot); }
+        }
+
+        void clear(const size_t cell) { // Unregister every slot in cell
+            head_[cell] = -1;
+            count_[cell] = 0;
+        }
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <utility>
+
+#include "../UserCommon/UC_include/ExtGameResult.h"
+
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// Charges the time of the GameManager turn loop to ExtGameResult phases. enter() switches the
+// phase being charged, so nested phases are exclusive. Only the GM thread may use it.
+// Compiled to nothing unless GM_209277367_322542887_PROFILE is defined (ENABLE_GM_PROFILE in
+// CMake) - the turn loop then pays no clock reads at all.
+class PhaseTimer {
+    public:
+        using Phase = ExtGameResult::Phase;
+        static constexpr Phase UNTIMED = ExtGameResult::PHASE_COUNT; // Outside the turn loop
+
+#ifdef GM_209277367_322542887_PROFILE
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        ExtGameResult* result_ = nullptr;
+        Phase current_ = UNTIMED;
+        Clock::time_point since_; // Start of the current phase
+
+    public:
+        void start(ExtGameResult& result) { // Time into result from now on
+            result_ = &result;
+            result_->timed = true;
+            current_ = UNTIMED;
+        }
+
+        Phase enter(const Phase phase) { // Returns the phase left
+            const Clock::time_point now = Clock::now();
+            if (current_ != UNTIMED && result_ != nullptr) {
+                result_->phaseNanoseconds[current_] +=
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - since_).count();
+            }
+            since_ = now;
+            return std::exchange(current_, phase);
+        }
+#else
+    public:
+        void start(ExtGameResult&) {}
+        Phase enter(Phase) { return UNTIMED; }
+#endif
+};
+
+// Charges its lifetime to one phase and switches back to the enclosing phase when destroyed
+class PhaseScope {
+    PhaseTimer& timer_;
+    PhaseTimer::Phase previous_;
+
+    public:
+        // Rule of 5
+        PhaseScope(PhaseTimer& timer, const PhaseTimer::Phase phase) : timer_(timer), previous_(timer.enter(phase)) {}
+        PhaseScope(const PhaseScope&) = delete;
+        PhaseScope& operator=(const PhaseScope&) = delete;
+        PhaseScope(PhaseScope&&) noexcept = delete;
+        PhaseScope& operator=(PhaseScope&&) noexcept = delete;
+        ~PhaseScope() { timer_.enter(previous_); }
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GM_209277367_322542887.h"
+#include "ReplayFormat.h"
+#include "../UserCommon/UC_include/Gameboard.h"
+
+using std::string, std::vector, std::unique_ptr, std::size_t;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// A game recorded in the binary replay format (see ReplayFormat.h)
+struct Replay {
+    size_t width = 0;
+    size_t height = 0;
+    size_t maxSteps = 0;
+    size_t numShells = 0;
+    size_t tankCount = 0;
+    size_t turns = 0; // Turns recorded
+    string mapName;
+    string name1;
+    string name2;
+    Gameboard map; // Initial board
+    vector<vector<ActionRequest>> scripts; // Per tank (tanks_ order): the action of every turn it was alive at the start of
+
+    static Replay load(const string& path); // Read and parse a .tkr file, throws std::runtime_error
+    static Replay parse(const string& bytes); // Parse a replay, throws std::runtime_error if malformed
+};
+
+// Plays a recorded game again through the GM rules (moves, shots, shell resolution), feeding
+// every tank its recorded actions. No Player or TankAlgorithm is loaded: scripted stand-ins
+// return the recorded actions, and ignored actions are requested again and rejected again
+// by the GM. Any turn can be reached with seek(); the game state is checkpointed every
+// CHECKPOINT_INTERVAL turns, so seeking backwards replays from the nearest checkpoint.
+class ReplayEngine {
+    static constexpr size_t CHECKPOINT_INTERVAL = 64;
+
+    struct Checkpoint {
+        GameState state;
+        vector<size_t> cursors;
+    };
+
+    Replay replay_; // Declared first - the tanks of gm_ point into its scripts
+    vector<size_t> cursors_; // Per tank: next action in its script
+    unique_ptr<GM_209277367_322542887> gm_; // Game being replayed
+    unique_ptr<Player> player_; // Scripted player shared by both sides
+    size_t createdTanks_ = 0; // Tanks created so far - tanks are created in tanks_ order
+    size_t turn_ = 0; // Turns played
+    bool finished_ = false; // finishGame() was called on gm_
+    vector<Checkpoint> checkpoints_; // State after every CHECKPOINT_INTERVAL turns, from turn 0
+
+    void saveCheckpoint();
+
+    public:
+        // Rule of 5
+        explicit ReplayEngine(Replay replay);
+        ReplayEngine(const ReplayEngine&) = delete;
+        ReplayEngine& operator=(const ReplayEngine&) = delete;
+        ReplayEngine(ReplayEngine&&) noexcept = delete;
+        ReplayEngine& operator=(ReplayEngine&&) noexcept = delete;
+        ~ReplayEngine() = default;
+
+        void restart(); // Back to the initial board, dropping the checkpoints
+        bool step(); // Play one turn, false once the game is over
+        void seek(size_t turn); // Board after the given number of turns (or at the end of the game)
+        GameResult run(); // Play to the end of the game and return its result (the final board moves into it)
+
+        size_t getTurn() const { return turn_; }
+        bool isGameOver() const { return gm_->isGameOver(); }
+        const Gameboard& getGameboard() const { return gm_->getGameboard(); }
+        uint64_t getStateHash() const { return gm_->getStateHash(); } // For validating a replay against the recorded game
+        const Replay& getReplay() const { return replay_; }
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../common/ActionRequest.h"
+
+using std::string, std::size_t;
+
+namespace GameManager_209277367_322542887 {
+
+// Binary replay format (.tkr), all integers little-endian:
+//   header   "TKRP", u8 version, u32 width, u32 height, u32 max_steps, u32 num_shells,
+//            u32 tank count, u32 turns, then map name, player 1 name and player 2 name
+//            (each a u16 length followed by the bytes)
+//   map      width * height cells in row-major order, one nibble per cell (MAP_SYMBOLS index)
+//   turns    per turn, one nibble per tank in tanks_ order (see the ACTION_* codes)
+// Nibbles are packed two per byte, low nibble first; the map and the turns are padded
+// to a whole byte separately. ESCAPE nibbles make both streams lossless.
+namespace ReplayFormat {
+    inline constexpr std::array<char, 4> MAGIC = {'T', 'K', 'R', 'P'};
+    inline constexpr uint8_t VERSION = 1;
+
+    // Turn nibbles: 0..8 = ActionRequest performed as requested, ACTION_NONE = tank was not
+    // alive at the start of the turn, ESCAPE + action nibble = action that was ignored
+    inline constexpr uint8_t ACTION_COUNT = 9;
+    inline constexpr uint8_t ACTION_NONE = 9;
+    inline constexpr uint8_t ESCAPE = 15;
+
+    // Map nibbles: index into MAP_SYMBOLS, or ESCAPE followed by the raw byte (two nibbles)
+    inline constexpr std::array<char, 6> MAP_SYMBOLS = {' ', '#', '@', '1', '2', '$'};
+
+    constexpr uint8_t actionCode(const ActionRequest action) { return static_cast<uint8_t>(action); }
+    constexpr ActionRequest actionFromCode(const uint8_t code) { return static_cast<ActionRequest>(code); }
+}
+
+// Appends nibbles to a byte string, low nibble first
+class NibbleWriter {
+    string bytes_;
+    bool half_ = false; // Last byte has only its low nibble filled
+
+    public:
+        void put(const uint8_t nibble) {
+            if (half_) { bytes_.back() = static_cast<char>(static_cast<uint8_t>(bytes_.back()) | (nibble << 4)); }
+            else { bytes_.push_back(static_cast<char>(nibble & 0x0F)); }
+            half_ = !half_;
+        }
+
+        const string& bytes() const { return bytes_; }
+        void clear() { bytes_.clear(); half_ = false; }
+};
+
+// Reads nibbles from a byte range written by NibbleWriter
+class NibbleReader {
+    const uint8_t* data_;
+    size_t size_; // Bytes available
+    size_t nibble_ = 0; // Next nibble to read
+
+    public:
+        NibbleReader(const uint8_t* data, const size_t size) : data_(data), size_(size) {}
+
+        bool atEnd() const { return nibble_ >= 2 * size_; }
+        uint8_t get() { // Next nibble, 0 past the end
+            if (atEnd()) { return 0; }
+            const uint8_t byte = data_[nibble_ / 2];
+            return (nibble_++ % 2 == 0) ? (byte & 0x0F) : (byte >> 4);
+        }
+        size_t bytesUsed() const { return (nibble_ + 1) / 2; } // Whole bytes consumed so far
+};
+
+} // namespace GameManager_209277367_322542887
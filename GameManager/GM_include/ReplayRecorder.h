@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ReplayFormat.h"
+#include "../UserCommon/UC_include/Gameboard.h"
+
+using std::string, std::size_t;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// Records a game in the binary replay format (see ReplayFormat.h): the initial map
+// followed by every tank's action and validity, about half a byte per tank per turn.
+class ReplayRecorder {
+    string header_; // Header without the turn count, which is only known at the end
+    NibbleWriter map_;
+    NibbleWriter turns_;
+    size_t turnCount_ = 0;
+    size_t headerTurnsOffset_ = 0; // Position of the u32 turn count in the header
+
+    public:
+        // Rule of 5
+        ReplayRecorder() = default;
+        ReplayRecorder(const ReplayRecorder&) = delete;
+        ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+        ReplayRecorder(ReplayRecorder&&) noexcept = default;
+        ReplayRecorder& operator=(ReplayRecorder&&) noexcept = default;
+        ~ReplayRecorder() = default;
+
+        // Start a new recording from the initial map and game parameters
+        void begin(const Gameboard& map, size_t max_steps, size_t num_shells, size_t tank_count,
+            const string& map_name, const string& name1, const string& name2);
+
+        void recordAction(ActionRequest action, bool valid); // Next tank acted this turn
+        void recordNoAction(); // Next tank was not alive at the start of this turn
+        void endTurn() { ++turnCount_; }
+
+        string finish(); // The complete replay; the recorder must be begun again before reuse
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "ShellPool.h"
+#include "../UserCommon/UC_include/Direction.h"
+#include "../UserCommon/UC_include/Gameboard.h"
+
+using std::array, std::size_t;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// Bit-plane copy of the board used to advance all shells of a half step at once, for boards of
+// up to MAX_SIDE x MAX_SIDE cells. Every board symbol class has one plane, and the shells are
+// split into one plane per direction. A plane holds one word per column (bit y of word x is
+// cell (x, y)), so moving a plane one step is a rotation of every word (wrapping at the bottom
+// edge) and a rotation of the word order (wrapping at the right edge), and what each shell hits
+// is an AND with the board planes. Only the columns from the leftmost to the rightmost shell
+// (and their neighbors) are processed. Walking a plane visits cells in (x, y) order - the order
+// checkShellsCollide keeps the shells in.
+// A half step is only resolved here when no shell can affect another: no two shells share a
+// cell or a target, no target holds a shell, and no shell sits on or flies into a tank mark.
+// Then the sequential rules of moveShells give the same result in any order; otherwise the
+// caller falls back to them.
+class ShellBitboard {
+    public:
+        static constexpr int MAX_SIDE = 64; // Larger boards use moveShells only
+        static constexpr int MIN_SHELLS = 32; // Sparser half steps are cheaper in moveShells
+
+        // Board symbol classes, one plane each
+        enum Plane { EMPTY, WALL, WEAK_WALL, MINE, TANK1, TANK2, SHELL, OTHER, PLANE_COUNT };
+
+    private:
+        using Bits = array<uint64_t, MAX_SIDE>; // Per column: one bit per row
+
+        int width_ = 0;
+        int height_ = 0;
+        uint64_t columnMask_ = 0; // Bits of the rows that exist
+        array<Bits, PLANE_COUNT> board_{}; // Per symbol class: cells holding it
+        array<Bits, DIRECTION_COUNT> shells_{}; // Per direction: shells flying that way
+        array<Bits, DIRECTION_COUNT> targets_{}; // Per direction: cells the shells fly into
+        Bits shellCells_{}; // Cells holding a shell before the half step
+        Bits targeted_{}; // Cells some shell flies into
+        unsigned activeDirections_ = 0; // Bit per direction with shells in the last advance()
+        int firstColumn_ = 0; // Columns the last advance() touched: [firstColumn_, lastColumn_]
+        int lastColumn_ = -1;
+
+        // Results of the last advance()
+        Bits wallHits_{};
+        Bits weakWallHits_{};
+        Bits tankHits_{};
+        Bits landed_{}; // Cells holding a shell after the half step
+        Bits landedOnMine_{};
+
+        static Plane planeOf(const char symbol) {
+            switch (symbol) {
+                case ' ': return EMPTY;
+                case '#': return WALL;
+                case '$': return WEAK_WALL;
+                case '@': return MINE;
+                case '1': return TANK1;
+                case '2': return TANK2;
+                case '*': return SHELL;
+                default: return OTHER; // Stacked shells and tank marks
+            }
+        }
+
+        void shift(const Bits& from, Bits& to, Direction dir) const; // Move the bits of the touched columns one step in dir
+
+        template <typename F> void forEach(const Bits& bits, F f) const { // f(x, y) for every set bit, in (x, y) order
+            for (int x = firstColumn_; x <= lastColumn_; ++x) {
+                for (uint64_t column = bits[x]; column != 0; column &= column - 1) { f(x, std::countr_zero(column)); }
+            }
+        }
+
+    public:
+        // Rule of 5
+        ShellBitboard() = default;
+        ShellBitboard(const ShellBitboard&) = default;
+        ShellBitboard& operator=(const ShellBitboard&) = default;
+        ShellBitboard(ShellBitboard&&) noexcept = default;
+        ShellBitboard& operator=(ShellBitboard&&) noexcept = default;
+        ~ShellBitboard() = default;
+
+        static bool fits(const int width, const int height) {
+            return width > 0 && height > 0 && width <= MAX_SIDE && height <= MAX_SIDE;
+        }
+
+        void assign(const Gameboard& board); // Rebuild the planes from the board (must fit)
+
+        // Keep the planes in sync with a board write - defined inline, it runs on every setCell
+        void update(const int x, const int y, const char old_symbol, const char symbol) {
+            const Plane from = planeOf(old_symbol);
+            const Plane to = planeOf(symbol);
+            if (from == to) { return; }
+            board_[from][x] &= ~(uint64_t{1} << y);
+            board_[to][x] |= uint64_t{1} << y;
+        }
+
+        // Resolve one half step of the shells in pool; false if it needs the sequential rules
+        bool advance(const ShellPool& pool);
+
+        // Results of a successful advance(), as cells
+        template <typename F> void forEachWallHit(F f) const { forEach(wallHits_, f); }
+        template <typename F> void forEachWeakWallHit(F f) const { forEach(weakWallHits_, f); }
+        template <typename F> void forEachTankHit(F f) const { forEach(tankHits_, f); }
+        template <typename F> void forEachLandedShell(F f) const { // f(x, y, direction, above_mine), in (x, y) order
+            forEach(landed_, [&](const int x, const int y) {
+                int dir = 0;
+                while (!(activeDirections_ >> dir & 1) || !(targets_[dir][x] >> y & 1)) { ++dir; }
+                f(x, y, static_cast<Direction>(dir), static_cast<bool>(landedOnMine_[x] >> y & 1));
+            });
+        }
+};
+
+} // namespace GameManager_209277367_322542887
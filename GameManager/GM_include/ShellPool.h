@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../UserCommon/UC_include/Direction.h"
+
+using std::vector, std::size_t;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// Shells in flight, stored as parallel arrays (struct of arrays) indexed by slot.
+// Removing a shell only tombstones its slot, so the remaining shells keep their slots and
+// relative order; compact() drops the tombstones. Storage is reserved up front, so spawning,
+// removing and compacting never allocate once the pool has been reset.
+class ShellPool {
+    vector<int> x_;
+    vector<int> y_;
+    vector<Direction> direction_;
+    vector<char> aboveMine_; // Shell sits on top of a mine
+    vector<char> alive_; // 0 for tombstoned slots
+    int liveCount_ = 0;
+
+    // Scratch arrays used by compact(), kept to avoid reallocating
+    vector<int> scratchX_;
+    vector<int> scratchY_;
+    vector<Direction> scratchDirection_;
+    vector<char> scratchAboveMine_;
+
+    public:
+        // Rule of 5
+        ShellPool() = default;
+        ShellPool(const ShellPool&) = default;
+        ShellPool& operator=(const ShellPool&) = default;
+        ShellPool(ShellPool&&) noexcept = default;
+        ShellPool& operator=(ShellPool&&) noexcept = default;
+        ~ShellPool() = default;
+
+        void reset(const size_t capacity) { // Remove every shell and reserve room for capacity shells
+            for (auto* column : {&x_, &y_, &scratchX_, &scratchY_}) { column->clear(); column->reserve(capacity); }
+            for (auto* column : {&direction_, &scratchDirection_}) { column->clear(); column->reserve(capacity); }
+            for (auto* column : {&aboveMine_, &alive_, &scratchAboveMine_}) { column->clear(); column->reserve(capacity); }
+            liveCount_ = 0;
+        }
+
+        void clear() { // Remove every shell, keeping the storage
+            x_.clear();
+            y_.clear();
+            direction_.clear();
+            aboveMine_.clear();
+            alive_.clear();
+            liveCount_ = 0;
+        }
+
+        bool operator==(const ShellPool& other) const { // Same shells in the same slots (scratch arrays aside)
+            return x_ == other.x_ && y_ == other.y_ && direction_ == other.direction_
+                && aboveMine_ == other.aboveMine_ && alive_ == other.alive_;
+        }
+
+        // Methods are defined inline - they run for every shell on every half step
+        int slots() const { return static_cast<int>(x_.size()); } // Number of slots, tombstones included
+        int liveCount() const { return liveCount_; }
+        bool empty() const { return liveCount_ == 0; }
+
+        int spawn(const int x, const int y, const Direction dir) { // Append a shell, returns its slot
+            x_.push_back(x);
+            y_.push_back(y);
+            direction_.push_back(dir);
+            aboveMine_.push_back(false);
+            alive_.push_back(true);
+            ++liveCount_;
+            return slots() - 1;
+        }
+
+        void kill(const int slot) { // Tombstone the slot
+            alive_[slot] = false;
+            --liveCount_;
+        }
+
+        bool isAlive(const int slot) const { return alive_[slot]; }
+
+        int nextAlive(int slot) const { // First live slot at or after slot, slots() if none
+            while (slot < slots() && !alive_[slot]) { ++slot; }
+            return slot;
+        }
+
+        int getX(const int slot) const { return x_[slot]; }
+        int getY(const int slot) const { return y_[slot]; }
+        Direction getDirection(const int slot) const { return direction_[slot]; }
+        bool isAboveMine(const int slot) const { return aboveMine_[slot]; }
+        void setAboveMine(const int slot, const bool above) { aboveMine_[slot] = above; }
+        void setLocation(const int slot, const int x, const int y) { x_[slot] = x; y_[slot] = y; }
+
+        // Keep only the given live slots, in the given order - they become slots 0..keep.size()-1
+        void compact(const vector<int>& keep) {
+            scratchX_.clear();
+            scratchY_.clear();
+            scratchDirection_.clear();
+            scratchAboveMine_.clear();
+            for (const int slot : keep) {
+                scratchX_.push_back(x_[slot]);
+                scratchY_.push_back(y_[slot]);
+                scratchDirection_.push_back(direction_[slot]);
+                scratchAboveMine_.push_back(aboveMine_[slot]);
+            }
+
+            x_.swap(scratchX_);
+            y_.swap(scratchY_);
+            direction_.swap(scratchDirection_);
+            aboveMine_.swap(scratchAboveMine_);
+            alive_.assign(keep.size(), true);
+            liveCount_ = static_cast<int>(keep.size());
+        }
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../common/TankAlgorithm.h"
+#include "../UserCommon/UC_include/Direction.h"
+
+using std::vector, std::size_t, std::pair, std::unique_ptr;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// The tanks of a game, stored as parallel arrays (struct of arrays) indexed by tank index -
+// the order the tanks appear on the map. Alongside the columns, live() lists the indices of
+// the tanks still in play in increasing order, so the per-turn loops visit only those.
+// A tank killed during a turn stays listed (with getIsAlive() == 1) until retireKilled() runs
+// at the end of the turn; between turns live() holds exactly the alive tanks.
+class TankTable {
+    public:
+        // Everything about the tanks that changes during a game - flat columns, copied by value
+        struct State {
+            vector<int> x;
+            vector<int> y;
+            vector<Direction> direction;
+            vector<int> ammo;
+            vector<int> turnsToShoot;
+            vector<int> turnsToBackwards; // Turns until a backward move is performed
+            vector<char> backwardsFlag; // Still wants to move backwards
+            vector<char> justMovedBackwards;
+            vector<int> turnsDead; // 0 alive, 1 killed this turn, then counts up
+            vector<char> destroyed; // Killed at some point (the alive / out-of-ammo counters know)
+            vector<int> live; // Indices of the tanks not retired yet, increasing
+
+            bool operator==(const State&) const = default;
+        };
+
+    private:
+        State state_;
+        vector<int> id_; // Per player tank number
+        vector<int> playerId_;
+        vector<unique_ptr<TankAlgorithm>> algorithm_;
+
+    public:
+        // Rule of 5
+        TankTable() = default;
+        TankTable(const TankTable&) = delete; // Owns the tank algorithms
+        TankTable& operator=(const TankTable&) = delete;
+        TankTable(TankTable&&) noexcept = default;
+        TankTable& operator=(TankTable&&) noexcept = default;
+        ~TankTable() = default;
+
+        void clear() { // Remove every tank (destroying the algorithms), keeping the storage
+            for (auto* column : {&state_.x, &state_.y, &state_.ammo, &state_.turnsToShoot, &state_.turnsToBackwards,
+                &state_.turnsDead, &state_.live, &id_, &playerId_}) { column->clear(); }
+            for (auto* column : {&state_.backwardsFlag, &state_.justMovedBackwards, &state_.destroyed}) { column->clear(); }
+            state_.direction.clear();
+            algorithm_.clear();
+        }
+
+        int add(const int id, const int x, const int y, const int ammo, const int player_id,
+            unique_ptr<TankAlgorithm> algorithm) { // Append an alive tank, returns its index
+            const int index = size();
+            state_.x.push_back(x);
+            state_.y.push_back(y);
+            state_.direction.push_back(player_id == 1 ? Direction::L : Direction::R); // Facing the other player
+            state_.ammo.push_back(ammo);
+            state_.turnsToShoot.push_back(0);
+            state_.turnsToBackwards.push_back(2);
+            state_.backwardsFlag.push_back(false);
+            state_.justMovedBackwards.push_back(false);
+            state_.turnsDead.push_back(0);
+            state_.destroyed.push_back(false);
+            state_.live.push_back(index);
+            id_.push_back(id);
+            playerId_.push_back(player_id);
+            algorithm_.push_back(std::move(algorithm));
+            return index;
+        }
+
+        // Methods are defined inline - they run for every live tank on every turn
+        int size() const { return static_cast<int>(id_.size()); }
+        const vector<int>& live() const { return state_.live; }
+
+        void retireKilled() { // End of turn: age the tanks killed this turn and drop them from live()
+            size_t kept = 0;
+            for (const int index : state_.live) {
+                if (state_.turnsDead[index] == 0) { state_.live[kept++] = index; }
+                else if (state_.turnsDead[index] == 1) { increaseTurnsDead(index); }
+            }
+            state_.live.resize(kept);
+        }
+
+        // Saved state, for GameState - the ids, players and algorithms are fixed for the game
+        const State& getState() const { return state_; }
+        void setState(const State& state) { state_ = state; }
+
+        int getID(const int index) const { return id_[index]; }
+        int getPlayerId(const int index) const { return playerId_[index]; }
+        TankAlgorithm& getTank(const int index) const { return *algorithm_[index]; }
+        unique_ptr<TankAlgorithm>& getTankSlot(const int index) { return algorithm_[index]; } // ActionWatchdog may take it
+
+        pair<int, int> getLocation(const int index) const { return {state_.x[index], state_.y[index]}; }
+        Direction getDirection(const int index) const { return state_.direction[index]; }
+        int getAmmo(const int index) const { return state_.ammo[index]; }
+        int getTurnsToShoot(const int index) const { return state_.turnsToShoot[index]; }
+        int getTurnsToBackwards(const int index) const { return state_.turnsToBackwards[index]; }
+        bool isMovingBackwards(const int index) const { return state_.backwardsFlag[index]; }
+        bool justMovedBackwards(const int index) const { return state_.justMovedBackwards[index]; }
+        int getIsAlive(const int index) const { return state_.turnsDead[index]; }
+        bool isDestroyed(const int index) const { return state_.destroyed[index]; }
+
+        void setLocation(const int index, const int x, const int y) { state_.x[index] = x; state_.y[index] = y; }
+        void setDirection(const int index, const Direction dir) { state_.direction[index] = dir; }
+        void decreaseAmmo(const int index) { state_.ammo[index] = std::max(0, state_.ammo[index] - 1); }
+        void decreaseTurnsToShoot(const int index) { if (state_.turnsToShoot[index] > 0) { --state_.turnsToShoot[index]; } }
+        void resetTurnsToShoot(const int index) { state_.turnsToShoot[index] = 4; }
+        void decreaseTurnsToBackwards(const int index) { --state_.turnsToBackwards[index]; }
+        void restartTurnsToBackwards(const int index) { state_.turnsToBackwards[index] = 2; }
+        void zeroTurnsToBackwards(const int index) { state_.turnsToBackwards[index] = 0; }
+        void switchBackwardsFlag(const int index) { state_.backwardsFlag[index] = !state_.backwardsFlag[index]; }
+        void switchJustMovedBackwardsFlag(const int index) { state_.justMovedBackwards[index] = !state_.justMovedBackwards[index]; }
+        void setDestroyed(const int index) { state_.destroyed[index] = true; }
+
+        void increaseTurnsDead(const int index) { // Also moves the tank off the board
+            ++state_.turnsDead[index];
+            setLocation(index, -1, -1);
+        }
+};
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using std::function, std::vector, std::size_t;
+
+namespace GameManager_209277367_322542887 {
+
+// Small fixed set of threads running parallel for-loops, owned by a single game.
+// run() hands the indices out one at a time and returns once every index was processed;
+// the calling thread works too, so a pool of n threads starts n - 1 workers.
+class TaskPool {
+    std::mutex mutex_;
+    std::condition_variable workReady_; // Signalled when run() posts a loop or the pool stops
+    std::condition_variable workDone_; // Signalled when the last worker finishes the loop
+    vector<std::thread> workers_;
+    const function<void(size_t)>* task_ = nullptr; // Body of the current loop
+    size_t taskCount_ = 0; // Indices in the current loop
+    std::atomic<size_t> nextTask_ = 0; // Next index to hand out
+    size_t busyWorkers_ = 0; // Workers still on the current loop
+    size_t generation_ = 0; // Loops posted so far
+    bool stopping_ = false;
+    std::exception_ptr error_; // First exception thrown by the current loop
+
+    void workerLoop();
+    void work(); // Process indices until none are left
+
+    public:
+        // Rule of 5
+        explicit TaskPool(size_t threads);
+        TaskPool(const TaskPool&) = delete;
+        TaskPool& operator=(const TaskPool&) = delete;
+        TaskPool(TaskPool&&) noexcept = delete;
+        TaskPool& operator=(TaskPool&&) noexcept = delete;
+        ~TaskPool(); // Stops and joins the workers
+
+        size_t size() const { return workers_.size() + 1; } // Threads, the caller included
+
+        // Call task(i) for every i in [0, count) across the pool and wait for all of them.
+        // Rethrows the first exception a call threw, after the whole loop has stopped.
+        void run(size_t count, const function<void(size_t)>& task);
+};
+
+} // namespace GameManager_209277367_322542887
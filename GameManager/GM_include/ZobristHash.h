@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../UserCommon/UC_include/Direction.h"
+
+using std::size_t;
+using namespace UserCommon_209277367_322542887;
+
+namespace GameManager_209277367_322542887 {
+
+// 64-bit Zobrist hash of a game state: the XOR of one pseudo-random key per board cell symbol,
+// per alive tank (index, cell, direction) and per shell (cell, direction, above a mine).
+// Every change is applied by toggling the key of the old value out and the new one in, so the
+// hash is updated in constant time. Keys are computed with the splitmix64 finalizer instead of
+// being stored in tables, so they need no memory and are the same in every process.
+class ZobristHash {
+    uint64_t value_ = 0;
+
+    enum Kind : uint64_t { CELL = 1, TANK = 2, SHELL = 3, COUNTERS = 4 };
+
+    static uint64_t key(const Kind kind, const uint64_t a, const uint64_t b) {
+        uint64_t z = (kind << 60) ^ (a << 20) ^ b; // Distinct for boards below 2^40 cells and 2^17 tanks
+        z += 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    public:
+        // Methods are defined inline - toggleCell() runs on every board write
+        void clear() { value_ = 0; }
+        uint64_t value() const { return value_; }
+        void set(const uint64_t value) { value_ = value; }
+
+        void toggleCell(const size_t cell, const char symbol) {
+            value_ ^= key(CELL, cell, static_cast<unsigned char>(symbol));
+        }
+
+        void toggleTank(const size_t tank_index, const size_t cell, const Direction dir) {
+            value_ ^= key(TANK, cell, (static_cast<uint64_t>(tank_index) << 3) | dirIndex(dir));
+        }
+
+        void toggleShell(const size_t cell, const Direction dir, const bool above_mine) {
+            value_ ^= key(SHELL, cell, (static_cast<uint64_t>(above_mine) << 3) | dirIndex(dir));
+        }
+
+        // Values outside the board state (timers, actions) packed by the caller into 40 bits
+        void toggleCounters(const size_t owner, const uint64_t counters) {
+            value_ ^= key(COUNTERS, counters, owner);
+        }
+};
+
+} // namespace GameManager_209277367_322542887
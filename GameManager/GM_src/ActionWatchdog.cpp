@@ -0,0 +1,112 @@
+#include "ActionWatchdog.h"
+
+#include <ctime>
+#include <exception>
+#include <utility>
+
+namespace GameManager_209277367_322542887 {
+
+// CPU time used by the calling thread - unlike wall time, not inflated by other games' threads
+uint64_t threadCpuNanoseconds() {
+    timespec now{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+struct ActionWatchdog::Runner {
+    std::mutex mutex;
+    std::condition_variable wake; // Signalled when a call is posted or the runner stops
+    std::condition_variable done; // Signalled when the call returns
+    std::thread thread;
+    TankAlgorithm* algorithm = nullptr; // The posted call, until it returns
+    bool returned = false;
+    ActionRequest action = ActionRequest::DoNothing;
+    uint64_t cpuNanoseconds = 0;
+    std::exception_ptr error;
+    unique_ptr<TankAlgorithm> abandoned; // Set when the caller stopped waiting, destroyed when the call returns
+    bool stopping = false;
+};
+
+// Destructor - stops the idle runners and joins them
+ActionWatchdog::~ActionWatchdog() {
+    for (const auto& runner : idle_) {
+        {
+            std::lock_guard lock(runner->mutex);
+            runner->stopping = true;
+        }
+        runner->wake.notify_one();
+        runner->thread.join();
+    }
+}
+
+bool ActionWatchdog::call(unique_ptr<TankAlgorithm>& algorithm, const std::chrono::nanoseconds limit,
+    ActionRequest& action, uint64_t& cpu_nanoseconds) {
+    shared_ptr<Runner> runner;
+    {
+        std::lock_guard lock(mutex_);
+        if (!idle_.empty()) {
+            runner = std::move(idle_.back());
+            idle_.pop_back();
+        }
+    }
+    if (!runner) {
+        runner = std::make_shared<Runner>();
+        runner->thread = std::thread(&ActionWatchdog::runnerLoop, runner);
+    }
+
+    std::unique_lock lock(runner->mutex);
+    runner->algorithm = algorithm.get();
+    runner->returned = false;
+    runner->wake.notify_one();
+    if (!runner->done.wait_for(lock, limit, [&] { return runner->returned; })) { // Abandon the call
+        runner->abandoned = std::move(algorithm);
+        runner->thread.detach();
+        action = ActionRequest::DoNothing;
+        cpu_nanoseconds = 0;
+        return false;
+    }
+
+    action = runner->action;
+    cpu_nanoseconds = runner->cpuNanoseconds;
+    const std::exception_ptr error = std::exchange(runner->error, nullptr);
+    lock.unlock();
+    {
+        std::lock_guard pool_lock(mutex_);
+        idle_.push_back(std::move(runner));
+    }
+    if (error) { std::rethrow_exception(error); }
+    return true;
+}
+
+// Runner thread - makes the calls posted to it until stopped, or until a call is abandoned
+void ActionWatchdog::runnerLoop(const shared_ptr<Runner> runner) {
+    std::unique_lock lock(runner->mutex);
+    for (;;) {
+        runner->wake.wait(lock, [&] { return runner->stopping || runner->algorithm; });
+        if (!runner->algorithm) { return; } // Stopped
+        TankAlgorithm* const algorithm = runner->algorithm;
+        lock.unlock();
+
+        ActionRequest action = ActionRequest::DoNothing;
+        std::exception_ptr error;
+        const uint64_t start = threadCpuNanoseconds();
+        try { action = algorithm->getAction(); }
+        catch (...) { error = std::current_exception(); }
+        const uint64_t cpu_nanoseconds = threadCpuNanoseconds() - start;
+
+        lock.lock();
+        runner->algorithm = nullptr;
+        if (runner->abandoned) { // Nobody waits for this call - the thread is detached
+            const unique_ptr<TankAlgorithm> finished = std::move(runner->abandoned);
+            lock.unlock();
+            return;
+        }
+        runner->action = action;
+        runner->cpuNanoseconds = cpu_nanoseconds;
+        runner->error = error;
+        runner->returned = true;
+        runner->done.notify_one();
+    }
+}
+
+} // namespace GameManager_209277367_322542887
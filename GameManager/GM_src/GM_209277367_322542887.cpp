@@ -1,5 +1,9 @@
 #include "../GM_include/GM_209277367_322542887.h"
 
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+
 #include "../../common/GameManagerRegistration.h"
 
 using std::move, std::endl, std::getline, std::make_unique, std::make_pair, fs::path;
@@ -7,34 +11,335 @@ using std::move, std::endl, std::getline, std::make_unique, std::make_pair, fs::
 using namespace GameManager_209277367_322542887;
 REGISTER_GAME_MANAGER(GM_209277367_322542887);
 
-GM_209277367_322542887::GM_209277367_322542887(bool verbose) : verbose_(verbose) {}
+GM_209277367_322542887::GM_209277367_322542887(bool verbose) : verbose_(verbose) {
+    // Production runs can archive every game by pointing this variable at a directory
+    if (const char* replay_dir = std::getenv("GM_209277367_322542887_REPLAY_DIR"); replay_dir && *replay_dir) {
+        replayDir_ = replay_dir;
+    }
+    // Opt-in parallel callback phase, see setCallbackThreads
+    if (const char* threads = std::getenv("GM_209277367_322542887_CALLBACK_THREADS"); threads && *threads) {
+        callbackThreads_ = std::strtoul(threads, nullptr, 10);
+    }
+    // Opt-in cycle detection, see setCycleWindow
+    if (const char* window = std::getenv("GM_209277367_322542887_CYCLE_WINDOW"); window && *window) {
+        cycleWindow_ = std::strtoul(window, nullptr, 10);
+    }
+    // Opt-in bit-plane shell backend, see setShellBitboard
+    if (const char* bitboard = std::getenv("GM_209277367_322542887_SHELL_BITBOARD"); bitboard && *bitboard) {
+        shellBitboardEnabled_ = std::strtoul(bitboard, nullptr, 10) != 0;
+    }
+    // Opt-in tank algorithm time budgets, see setActionBudget
+    if (const char* call_us = std::getenv("GM_209277367_322542887_ACTION_BUDGET_US"); call_us && *call_us) {
+        actionBudgetNs_ = std::strtoull(call_us, nullptr, 10) * 1'000;
+    }
+    if (const char* game_ms = std::getenv("GM_209277367_322542887_GAME_BUDGET_MS"); game_ms && *game_ms) {
+        gameBudgetNs_ = std::strtoull(game_ms, nullptr, 10) * 1'000'000;
+    }
+    if (const char* timeout_ms = std::getenv("GM_209277367_322542887_ACTION_TIMEOUT_MS"); timeout_ms && *timeout_ms) {
+        actionTimeoutNs_ = std::strtoull(timeout_ms, nullptr, 10) * 1'000'000;
+    }
+}
 
 /**
- * @brief Retrieves and stores the next actions for all tanks in the game.
+ * @brief Records the next game played by this GameManager as a binary replay.
  *
- * This method clears the current list of tank actions and then iterates over all tanks.
- * If a tank is alive, it requests the next action from the tank's algorithm.
- * Otherwise, it records a "DoNothing" action for that tank.
+ * Takes precedence over the GM_209277367_322542887_REPLAY_DIR environment variable.
+ * See ReplayFormat.h for the file layout.
  *
- * @note The second value in the stored pair indicates whether the action is valid (true) or a placeholder (false).
+ * @param path Output file for the replay; empty to stop recording.
+ */
+void GM_209277367_322542887::setReplayFile(const string& path) { replayFile_ = path; }
+
+/**
+ * @brief Archives the replay of every game played by this GameManager to a directory.
+ *
+ * Overrides the GM_209277367_322542887_REPLAY_DIR environment variable; a file set
+ * with setReplayFile() still takes precedence.
+ *
+ * @param dir Output directory for the replays; empty to stop archiving.
+ */
+void GM_209277367_322542887::setReplayDir(const string& dir) { replayDir_ = dir; }
+
+/**
+ * @brief Runs the tank and player callbacks of every turn on a per-game thread pool.
+ *
+ * With more than one thread, getAction() is called for all tanks in parallel, and the
+ * battle info is handed to each player after the action phase, in tank order - both players
+ * at once, but never two calls on the same player. Actions
+ * are still resolved serially in tank order, so the game plays out exactly as in serial
+ * mode. Tank algorithms must not share mutable state with each other. Overrides the
+ * GM_209277367_322542887_CALLBACK_THREADS environment variable; applies from the next game.
+ *
+ * @param threads Threads for the callback phase, the game's own thread included; 0 or 1 for serial.
+ */
+void GM_209277367_322542887::setCallbackThreads(const size_t threads) { callbackThreads_ = threads; }
+
+/**
+ * @brief Ends stalemated games early, as a tie, once the game repeats a cycle.
+ *
+ * After every turn the GM compares a key of the full state - board, tanks, shells, the
+ * tanks' ammo, cooldowns and backward-move timers, and the actions just taken - with the
+ * keys of earlier turns. Once the keys repeat with a period of P turns (P <= @p turns) and
+ * the full state after P more turns equals the one saved when the repetition started, the
+ * game ends in a tie with reason MAX_STEPS, its rounds being the turns actually played
+ * (fewer than max_steps, which tells it apart from a game that ran out of steps), and the
+ * verbose log ends with a line saying the game repeats. The state compared is the GM's
+ * only: an algorithm with hidden state (a turn counter, randomness) might still have left
+ * the cycle, so this is a distinct outcome rather than a prediction of the full game, and
+ * the mode is opt-in. Games are not ended while a replay is being recorded, or while the
+ * zero-shells countdown runs (it ends the game soon anyway). Overrides the
+ * GM_209277367_322542887_CYCLE_WINDOW environment variable; applies from the next game.
+ *
+ * @param turns Longest cycle to detect, in turns; 0 to turn detection off.
+ */
+void GM_209277367_322542887::setCycleWindow(const size_t turns) { cycleWindow_ = turns; }
+
+/**
+ * @brief Advances the shells with the bit-plane backend (ShellBitboard) where possible.
+ *
+ * On boards of up to ShellBitboard::MAX_SIDE x MAX_SIDE cells the board is mirrored into bit
+ * planes, and every half step with at least ShellBitboard::MIN_SHELLS shells, none of which can
+ * affect another, is resolved with word-parallel shifts and ANDs instead of moveShells() /
+ * checkShellsCollide(). Other half steps, and larger boards, use the sequential rules, so games
+ * play out exactly the same either way.
+ * Overrides the GM_209277367_322542887_SHELL_BITBOARD environment variable; applies from
+ * the next game.
+ *
+ * @param enabled Whether to use the backend.
+ */
+void GM_209277367_322542887::setShellBitboard(const bool enabled) { shellBitboardEnabled_ = enabled; }
+
+/**
+ * @brief Limits the time the tank algorithms may spend in getAction().
+ *
+ * Each call is measured with the CPU clock of the thread making it. A call over the per-call
+ * budget is played as DoNothing. A player whose calls add up to more than the per-game budget
+ * forfeits. With a time limit, every call runs on an ActionWatchdog thread, and a call still
+ * running after the limit (wall time) is abandoned: the tank does nothing and its player
+ * forfeits. A forfeit ends the game at the end of that turn, unless the turn ended it
+ * otherwise: the other player wins, with the forfeiting player's tanks counted as none
+ * remaining (a tie if both forfeited). The figures are reported in getExtGameResult(); budgets
+ * spent are not given back by restoreState(). An abandoned call may still be running when the
+ * game ends - its algorithm's library and this one must then stay loaded.
+ * Overrides the GM_209277367_322542887_ACTION_BUDGET_US, GM_209277367_322542887_GAME_BUDGET_MS
+ * and GM_209277367_322542887_ACTION_TIMEOUT_MS environment variables; applies from the next game.
+ *
+ * @param call_microseconds Budget of one getAction() call, 0 for none.
+ * @param game_milliseconds Budget of all getAction() calls of one player in a game, 0 for none.
+ * @param timeout_milliseconds Wall time after which a getAction() call is abandoned, 0 for none.
+ */
+void GM_209277367_322542887::setActionBudget(const uint64_t call_microseconds, const uint64_t game_milliseconds,
+    const uint64_t timeout_milliseconds) {
+    actionBudgetNs_ = call_microseconds * 1'000;
+    gameBudgetNs_ = game_milliseconds * 1'000'000;
+    actionTimeoutNs_ = timeout_milliseconds * 1'000'000;
+}
+
+/**
+ * @brief Key of the state after the current turn, including the actions taken in it.
+ *
+ * Extends @c stateHash_ with every alive tank's ammo, cooldowns, backward-move timers and
+ * action, and with the no-ammo flag. The no-ammo timer itself is left out - it counts down
+ * on every turn and would keep a stalemate from ever repeating (detectCycle() leaves the countdown alone).
+ *
+ * @return Key compared by the cycle detection.
+ */
+uint64_t GM_209277367_322542887::turnKey() const {
+    ZobristHash key;
+    key.set(stateHash_.value());
+    for (const int i : tanks_.live()) { // Called after updateGameLog - exactly the alive tanks
+        const uint64_t counters = static_cast<uint64_t>(tankActions_[i].first)
+            | static_cast<uint64_t>(tankActions_[i].second) << 4
+            | static_cast<uint64_t>(tanks_.isMovingBackwards(i)) << 5
+            | static_cast<uint64_t>(tanks_.justMovedBackwards(i)) << 6
+            | static_cast<uint64_t>(tanks_.getTurnsToBackwards(i) & 0xff) << 8
+            | static_cast<uint64_t>(tanks_.getTurnsToShoot(i) & 0xff) << 16
+            | static_cast<uint64_t>(tanks_.getAmmo(i) & 0xffff) << 24;
+        key.toggleCounters(i, counters);
+    }
+    key.toggleCounters(tanks_.size(), noAmmoFlag_);
+    return key.value();
+}
+
+/**
+ * @brief Forgets the turns seen so far by the cycle detection.
+ */
+void GM_209277367_322542887::resetCycleDetection() {
+    cycleLastSeen_.clear();
+    cyclePeriod_ = 0;
+    cycleMatches_ = 0;
+}
+
+/**
+ * @brief Whether the state after this turn is exactly the one saved at the start of the candidate cycle.
+ *
+ * Compares everything turnKey() covers - the board, the tanks, the shells, the counters and
+ * the actions just taken - except the turn and the no-ammo timer, which never repeat.
+ */
+bool GM_209277367_322542887::repeatsCycleStart() const {
+    return gameboard_ == cycleStart_.board && tanks_.getState() == cycleStart_.tanks && shells_ == cycleStart_.shells
+        && tankActions_ == cycleStartActions_ && aliveTanks_ == cycleStart_.aliveTanks
+        && outOfAmmoTanks_ == cycleStart_.outOfAmmoTanks && noAmmoFlag_ == cycleStart_.noAmmoFlag
+        && numTanks1_ == cycleStart_.numTanks1 && numTanks2_ == cycleStart_.numTanks2;
+}
+
+/**
+ * @brief Records the turn just played and ends the game once it is in a cycle.
+ *
+ * Called at the end of a turn that did not end the game, before @c turn_ is incremented.
+ * The turn repeats the turn P turns earlier if their keys are equal, P being the distance to
+ * the key's last occurrence. The first such turn starts a candidate cycle: its full state is
+ * saved in @c cycleStart_. Keys can collide, so after P more consecutive repeats the state
+ * must also equal @c cycleStart_ exactly; only then are the last P turns a cycle, and the
+ * game is over with @c gameOverStatus_ 4. O(1) per turn, plus a copy of the state when a
+ * candidate cycle starts and a comparison with it once per cycle.
+ */
+void GM_209277367_322542887::detectCycle() {
+    if (!replayPath_.empty() || noAmmoFlag_) { return; } // Recorded games, and the zero-shells countdown, play on
+    const uint64_t key = turnKey();
+    auto [seen, first] = cycleLastSeen_.try_emplace(key, turn_);
+    if (first) {
+        cycleMatches_ = 0;
+        return;
+    }
+
+    const int period = turn_ - seen->second;
+    seen->second = turn_;
+    if (period > static_cast<int>(cycleWindow_)) {
+        cycleMatches_ = 0;
+        return;
+    }
+    cycleMatches_ = (period == cyclePeriod_) ? cycleMatches_ + 1 : 1;
+    cyclePeriod_ = period;
+
+    if (cycleMatches_ == 1) { // A candidate cycle starts here
+        saveState(cycleStart_);
+        cycleStartActions_ = tankActions_;
+        return;
+    }
+    if ((cycleMatches_ - 1) % period != 0) { return; } // Not a whole number of cycles since the start
+    if (!repeatsCycleStart()) { // The keys collided - the state did not repeat
+        resetCycleDetection();
+        return;
+    }
+
+    gameOverStatus_ = 4; // The last cyclePeriod_ turns repeat
+    gameOver_ = true;
+}
+
+/**
+ * @brief Records the actions the tanks took this turn into the replay.
+ *
+ * Must run after performTankActions() and before updateGameLog(): tanks that were
+ * alive at the start of the turn are then exactly those with getIsAlive() <= 1.
+ * The replay has an entry for every tank, so this walks all of them.
+ */
+void GM_209277367_322542887::recordReplayTurn() {
+    for (int i = 0; i < tanks_.size(); ++i) {
+        if (tanks_.getIsAlive(i) <= 1) { replay_.recordAction(tankActions_[i].first, tankActions_[i].second); }
+        else { replay_.recordNoAction(); }
+    }
+    replay_.endTurn();
+}
+
+/**
+ * @brief Hands the finished replay over to the background writer.
+ *
+ * @param path Output file for the replay.
+ */
+void GM_209277367_322542887::writeReplay(const string& path) {
+    ofstream file(path, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open replay file: " << path << endl;
+        return;
+    }
+    GameLogWriter::get().submit(std::move(file), replay_.finish());
+    submittedLogs_ = true;
+}
+
+/**
+ * @brief Destructor - waits until the logs and replays this GameManager handed to the
+ * background writer are on disk.
+ *
+ * The simulators destroy their game managers at the end of their runs, so every file of the
+ * run is complete once they return.
+ */
+GM_209277367_322542887::~GM_209277367_322542887() {
+    if (submittedLogs_) { GameLogWriter::get().flush(); }
+}
+
+/**
+ * @brief Retrieves and stores the next actions for all alive tanks in the game.
+ *
+ * Walks the live tank list, which between turns holds exactly the alive tanks, and requests
+ * each tank's next action from its algorithm. @c tankActions_ stays indexed by tank; the
+ * entries of dead tanks are no longer read and are left as they are.
  *
- * @details
- * - Alive tanks have their action fetched via `getTank()->getAction()`.
- * - Dead tanks are assigned `ActionRequest::DoNothing`.
+ * @note The second value in the stored pair indicates whether the action is valid (true) or a placeholder (false).
  *
  * @param None
  * @return void
  */
 void GM_209277367_322542887::getTankActions() {
-    tankActions_.clear();
+    const vector<int>& live = tanks_.live();
+
+    if (extGameResult_.budgeted) { // Measure every call - each tank writes only its own entry
+        const auto ask = [this, &live](const size_t k) {
+            const int i = live[k];
+            if (actionTimeoutNs_ > 0) { // On a watchdog thread, abandoned after the time limit
+                ActionRequest action = ActionRequest::DoNothing;
+                actionTimedOut_[i] = !watchdog_->call(tanks_.getTankSlot(i), std::chrono::nanoseconds(actionTimeoutNs_),
+                    action, actionCpuNs_[i]);
+                tankActions_[i] = {action, true};
+                return;
+            }
+            const uint64_t start = threadCpuNanoseconds();
+            tankActions_[i] = {tanks_.getTank(i).getAction(), true};
+            actionCpuNs_[i] = threadCpuNanoseconds() - start;
+        };
+        if (callbackPool_) { callbackPool_->run(live.size(), ask); }
+        else { for (size_t k = 0; k < live.size(); ++k) { ask(k); } }
+        chargeActionBudgets();
+        return;
+    }
+
+    if (callbackPool_) { // Parallel mode - every tank writes only its own entry
+        callbackPool_->run(live.size(), [this, &live](const size_t k) {
+            tankActions_[live[k]] = {tanks_.getTank(live[k]).getAction(), true};
+        });
+        return;
+    }
+
+    // Get the actions for the alive tanks
+    for (const int i : live) { tankActions_[i] = {tanks_.getTank(i).getAction(), true}; }
+}
 
-    // Get the actions for both tanks
-    for (const auto & tank : tanks_) {
-        if (tank->getIsAlive() == 0) {
-            ActionRequest action = tank->getTank()->getAction();
-            tankActions_.emplace_back(action, true);
+/**
+ * @brief Applies the getAction() budgets to the turn's actions (see setActionBudget).
+ *
+ * Runs on the game thread after every call returned or was abandoned, so the outcome does not
+ * depend on the callback threads. Calls over the per-call budget are counted as overruns and
+ * replaced with DoNothing. A player with an abandoned call, or over the per-game budget, is
+ * marked as forfeited; playTurn() then ends the game.
+ */
+void GM_209277367_322542887::chargeActionBudgets() {
+    for (const int i : tanks_.live()) {
+        const int player = tanks_.getPlayerId(i) - 1;
+        if (actionTimedOut_[i]) { // Abandoned, already played as DoNothing
+            ++extGameResult_.timedOutCalls[player];
+            extGameResult_.forfeited[player] = true;
+            continue;
+        }
+        extGameResult_.actionCpuNanoseconds[player] += actionCpuNs_[i];
+        if (actionBudgetNs_ > 0 && actionCpuNs_[i] > actionBudgetNs_) {
+            tankActions_[i] = {ActionRequest::DoNothing, true};
+            ++extGameResult_.actionOverruns[player];
         }
-        else { tankActions_.emplace_back(ActionRequest::DoNothing, false); }
+    }
+
+    if (gameBudgetNs_ == 0) { return; }
+    for (int player = 0; player < 2; ++player) {
+        if (extGameResult_.actionCpuNanoseconds[player] > gameBudgetNs_) { extGameResult_.forfeited[player] = true; }
     }
 }
 
@@ -44,7 +349,7 @@ void GM_209277367_322542887::getTankActions() {
  * Determines if the requested action can be performed by the tank,
  * validating movement and shooting actions against the current game state.
  *
- * @param tank Reference to the TankInfo object representing the tank.
+ * @param tank_index Index of the tank in @c tanks_.
  * @param action The requested action to validate.
  * @return true if the action is allowed, false otherwise.
  *
@@ -53,13 +358,13 @@ void GM_209277367_322542887::getTankActions() {
  * - Shooting actions are validated via isValidShoot().
  * - All other actions are considered valid by default.
  */
-bool GM_209277367_322542887::isValidAction(const TankInfo& tank, const ActionRequest action) const {
+bool GM_209277367_322542887::isValidAction(const int tank_index, const ActionRequest action) const {
     switch(action) { // Check if the action is valid based on the tank's requested actions
         case ActionRequest::MoveForward:
         case ActionRequest::MoveBackward:
-            return isValidMove(tank, action); // Check if the move is valid
+            return isValidMove(tank_index, action); // Check if the move is valid
         case ActionRequest::Shoot:
-            return isValidShoot(tank); // Check if able to shoot
+            return isValidShoot(tank_index); // Check if able to shoot
         default:
             return true;
     }
@@ -71,25 +376,25 @@ bool GM_209277367_322542887::isValidAction(const TankInfo& tank, const ActionReq
  * Checks the next cell based on the tank's position and direction,
  * ensuring it is not blocked by walls or obstacles.
  *
- * @param tank Tank to validate movement for.
+ * @param tank_index Tank to validate movement for.
  * @param action Requested move action.
  * @return true if movement is allowed, false otherwise.
  */
-bool GM_209277367_322542887::isValidMove(const TankInfo& tank, const ActionRequest action) const {
+bool GM_209277367_322542887::isValidMove(const int tank_index, const ActionRequest action) const {
     // Get the current location of the tank
-    auto [fst, snd] = tank.getLocation();
+    auto [fst, snd] = tanks_.getLocation(tank_index);
     const int x = fst;
     const int y = snd;
-    const Direction dir = tank.getDirection(); // Get the direction of the tank
+    const Direction dir = tanks_.getDirection(tank_index); // Get the direction of the tank
 
     // Get the next cell based on the action
     char next_cell;
     if (action == ActionRequest::MoveBackward) { // If moving backwards, Update the technical direction
         auto [nx, ny] = nextLocation(x, y, dir, true);
-        next_cell = gameboard_[ny][nx];
+        next_cell = gameboard_.at(nx, ny);
     } else { // If moving forward, Update the technical direction
         auto [nx, ny] = nextLocation(x, y, dir);
-        next_cell = gameboard_[ny][nx];
+        next_cell = gameboard_.at(nx, ny);
     }
 
     return next_cell != '#' && next_cell != '$'; // Return true if the next cell is not a wall
@@ -100,12 +405,12 @@ bool GM_209277367_322542887::isValidMove(const TankInfo& tank, const ActionReque
  *
  * Valid if it has ammo and no shooting cooldown.
  *
- * @param tank Tank to check.
+ * @param tank_index Tank to check.
  * @return true if shooting is allowed, false otherwise.
  */
-bool GM_209277367_322542887::isValidShoot(const TankInfo& tank) const {
+bool GM_209277367_322542887::isValidShoot(const int tank_index) const {
     // Check if the tank has ammo and zeroed cooldown
-    return tank.getAmmo() > 0 && tank.getTurnsToShoot() == 0;
+    return tanks_.getAmmo(tank_index) > 0 && tanks_.getTurnsToShoot(tank_index) == 0;
 }
 
 /**
@@ -118,56 +423,56 @@ bool GM_209277367_322542887::isValidShoot(const TankInfo& tank) const {
  * - Determines the next cell in the firing direction.
  * - Updates the board and shell list based on what is hit (wall, tank, shell, mine, or empty space).
  *
- * @param tank Tank executing the shot.
+ * @param tank_index Tank executing the shot.
  */
-void GM_209277367_322542887::shoot(TankInfo& tank) {
-    if (!isValidShoot(tank)) { // Check if the shoot action is valid
-        tank.decreaseTurnsToShoot();
-        // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Tried to shoot illegally" << endl;
+void GM_209277367_322542887::shoot(const int tank_index) {
+    if (!isValidShoot(tank_index)) { // Check if the shoot action is valid
+        tanks_.decreaseTurnsToShoot(tank_index);
+        // cout << "Tank " << tanks_.getPlayerId(tank_index) << "." << tanks_.getID(tank_index) << " Tried to shoot illegally" << endl;
         return;
     }
 
-    tank.resetTurnsToShoot(); // Zero the cooldown
-    tank.decreaseAmmo();
+    tanks_.resetTurnsToShoot(tank_index); // Zero the cooldown
+    tanks_.decreaseAmmo(tank_index);
+    if (tanks_.getAmmo(tank_index) == 0) { ++outOfAmmoTanks_[tanks_.getPlayerId(tank_index) - 1]; } // Fired its last shell
 
     // Calculate the new position of the shell based on the tank's direction
-    auto [fst, snd] = tank.getLocation();
-    Direction dir = tank.getDirection();
+    auto [fst, snd] = tanks_.getLocation(tank_index);
+    Direction dir = tanks_.getDirection(tank_index);
 
     // Switch to check the next cell
-    switch(auto [new_x, new_y] = nextLocation(fst, snd, dir); gameboard_[new_y][new_x]){
+    switch(auto [new_x, new_y] = nextLocation(fst, snd, dir); gameboard_.at(new_x, new_y)){
         case '#': {// If the next cell is a wall
-            gameboard_[new_y][new_x] = '$'; // Weaken the wall
-            // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Shot and weakened wall at (" << new_x << ", " << new_y << ")" << endl;
+            setCell(new_x, new_y, '$'); // Weaken the wall
+            // cout << "Tank " << tanks_.getPlayerId(tank_index) << "." << tanks_.getID(tank_index) << " Shot and weakened wall at (" << new_x << ", " << new_y << ")" << endl;
             break;}
         case '$': {// If the next cell is a weak wall
-            gameboard_[new_y][new_x] = ' '; // Destroy the wall
-            // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Shot and destroyed wall at (" << new_x << ", " << new_y << ")" << endl;
+            setCell(new_x, new_y, ' '); // Destroy the wall
+            // cout << "Tank " << tanks_.getPlayerId(tank_index) << "." << tanks_.getID(tank_index) << " Shot and destroyed wall at (" << new_x << ", " << new_y << ")" << endl;
             break;}
         case '1': {  // If the next cell is occupied by tank 1
-            gameboard_[new_y][new_x] = 'c'; // Update the game board with the new position of the tank
-            shells_.emplace_back(make_unique<Shell>(new_x, new_y, dir)); // Add the shell to the list of shells
+            setCell(new_x, new_y, 'c'); // Update the game board with the new position of the tank
+            spawnShell(new_x, new_y, dir); // Add the shell to the list of shells
             break;}
         case '2': {// If the next cell is occupied by tank 2
-            gameboard_[new_y][new_x] = 'd'; // Update the game board with the new position of the destroyed tank
-            shells_.emplace_back(make_unique<Shell>(new_x, new_y, dir)); // Add the shell to the list of shells
+            setCell(new_x, new_y, 'd'); // Update the game board with the new position of the destroyed tank
+            spawnShell(new_x, new_y, dir); // Add the shell to the list of shells
             break;}
         case '*': { // If the next cell is a shell
-            gameboard_[new_y][new_x] = ' '; // Remove both shells from the game board
-            if (const auto shell_it = getShellAt(new_x, new_y); shell_it != shells_.end()) { // Find the shell at the new position
-                deleteShell(shell_it); // Delete the shell
+            setCell(new_x, new_y, ' '); // Remove both shells from the game board
+            if (const int shell = getShellAt(new_x, new_y); shell != -1) { // Find the shell at the new position
+                deleteShell(shell); // Delete the shell
             }
-            // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Shot a shell at (" << new_x << ", " << new_y << ")" << endl;
+            // cout << "Tank " << tanks_.getPlayerId(tank_index) << "." << tanks_.getID(tank_index) << " Shot a shell at (" << new_x << ", " << new_y << ")" << endl;
             break; }
         case '@': {// If the next cell is a mine
-            auto shell_loc = pair(new_x, new_y); // Create a new shell location
-            shells_.emplace_back(make_unique<Shell>(shell_loc, dir)); // Add the shell to the list of shells
-            gameboard_[new_y][new_x] = '*'; // Mark the shell's position on the game board
-            shells_.back()->setAboveMine(true); // Set the shell to be above the mine
+            const int shell = spawnShell(new_x, new_y, dir); // Add the shell to the list of shells
+            setCell(new_x, new_y, '*'); // Mark the shell's position on the game board
+            setShellAboveMine(shell, true); // Set the shell to be above the mine
             break;}
         default: {// If the next cell is empty
-            gameboard_[new_y][new_x] = '*'; // Mark the shell's position on the game board
-            shells_.emplace_back(make_unique<Shell>(new_x, new_y, dir)); // Add the shell to the list of shells
+            setCell(new_x, new_y, '*'); // Mark the shell's position on the game board
+            spawnShell(new_x, new_y, dir); // Add the shell to the list of shells
             break;}
     }
 }
@@ -180,23 +485,23 @@ void GM_209277367_322542887::shoot(TankInfo& tank) {
  * resolution (collisions, board updates, state changes) to
  * handleTankCollisionAt().
  *
- * @param tank Tank to move.
+ * @param tank_index Tank to move.
  * @param action Movement action (forward or backward).
  */
-void GM_209277367_322542887::moveTank(TankInfo& tank, const ActionRequest action) {
-    auto [x, y] = tank.getLocation();
-    Direction dir = tank.getDirection();
+void GM_209277367_322542887::moveTank(const int tank_index, const ActionRequest action) {
+    auto [x, y] = tanks_.getLocation(tank_index);
+    Direction dir = tanks_.getDirection(tank_index);
 
-    gameboard_[y][x] = ' ';
+    setCell(x, y, ' ');
 
     if (action == ActionRequest::MoveBackward) {
-        dir = static_cast<Direction>((static_cast<int>(dir) + 4) % 8);
+        dir = oppositeDirection(dir);
     }
 
     auto [new_x, new_y] = nextLocation(x, y, dir);
-    char next_cell = gameboard_[new_y][new_x];
+    char next_cell = gameboard_.at(new_x, new_y);
 
-    handleTankCollisionAt(tank, x, y, new_x, new_y, dir, next_cell);
+    handleTankCollisionAt(tank_index, x, y, new_x, new_y, dir, next_cell);
 }
 
 /**
@@ -210,46 +515,40 @@ void GM_209277367_322542887::moveTank(TankInfo& tank, const ActionRequest action
  * - default (another tank): destroys the moving tank, and also destroys the other tank if present.
  * In all destructive outcomes the target cell is cleared.
  *
- * @param tank      The tank being moved/collided.
- * @param old_x     Previous x-coordinate of the tank.
- * @param old_y     Previous y-coordinate of the tank.
- * @param new_x     Target x-coordinate to enter.
- * @param new_y     Target y-coordinate to enter.
- * @param dir       Movement direction of the tank.
- * @param next_cell Board symbol at (new_x, new_y) before resolving the move.
+ * @param tank_index The tank being moved/collided.
+ * @param old_x      Previous x-coordinate of the tank.
+ * @param old_y      Previous y-coordinate of the tank.
+ * @param new_x      Target x-coordinate to enter.
+ * @param new_y      Target y-coordinate to enter.
+ * @param dir        Movement direction of the tank.
+ * @param next_cell  Board symbol at (new_x, new_y) before resolving the move.
  */
 void GM_209277367_322542887::handleTankCollisionAt(
-    TankInfo& tank, int old_x, int old_y,
+    const int tank_index, int old_x, int old_y,
     int new_x, int new_y, Direction dir, char next_cell) {
 
-    const int player_id = tank.getPlayerId();
+    const int player_id = tanks_.getPlayerId(tank_index);
 
     switch (next_cell) {
         case ' ': {
-            gameboard_[new_y][new_x] = static_cast<char>('0' + player_id);
-            tank.setLocation(new_x, new_y);
+            setCell(new_x, new_y, static_cast<char>('0' + player_id));
+            relocateTank(tank_index, new_x, new_y);
             break;
         }
         case '@': {
-            int tank_index = getTankIndexAt(old_x, old_y);
-            destroyedTanksIndices_.insert(tank_index);
-            tanks_[tank_index]->increaseTurnsDead();
-            gameboard_[new_y][new_x] = ' ';
+            killTank(getTankIndexAt(old_x, old_y));
+            setCell(new_x, new_y, ' ');
             break;
         }
         case '*': {
-            ShellIterator shell_it = getShellAt(new_x, new_y);
-            int shell_dir = static_cast<int>((*shell_it)->getDirection());
-
-            if (static_cast<int>(dir) == ((shell_dir + 4) % 8)) {
-                int tank_index = getTankIndexAt(old_x, old_y);
-                destroyedTanksIndices_.insert(tank_index);
-                tanks_[tank_index]->increaseTurnsDead();
-                deleteShell(shell_it);
-                gameboard_[new_y][new_x] = ' ';
+            const int shell = getShellAt(new_x, new_y);
+            if (areOppositeDirections(dir, shells_.getDirection(shell))) {
+                killTank(getTankIndexAt(old_x, old_y));
+                deleteShell(shell);
+                setCell(new_x, new_y, ' ');
             } else {
-                gameboard_[new_y][new_x] = (player_id == 1) ? 'a' : 'b';
-                tank.setLocation(new_x, new_y);
+                setCell(new_x, new_y, (player_id == 1) ? 'a' : 'b');
+                relocateTank(tank_index, new_x, new_y);
             }
             break;
         }
@@ -257,15 +556,13 @@ void GM_209277367_322542887::handleTankCollisionAt(
             int self_idx = getTankIndexAt(old_x, old_y);
             int other_idx = getTankIndexAt(new_x, new_y);
 
-            destroyedTanksIndices_.insert(self_idx);
-            tanks_[self_idx]->increaseTurnsDead();
+            killTank(self_idx);
 
             if (other_idx != -1) {
-                destroyedTanksIndices_.insert(other_idx);
-                tanks_[other_idx]->increaseTurnsDead();
+                killTank(other_idx);
             }
 
-            gameboard_[new_y][new_x] = ' ';
+            setCell(new_x, new_y, ' ');
             break;
         }
     }
@@ -279,33 +576,35 @@ void GM_209277367_322542887::handleTankCollisionAt(
  * (left/right 45° or 90°) and updates the tank's orientation.
  * If the action is not a rotation, the direction remains unchanged.
  *
- * @param tank Tank to rotate.
+ * @param tank_index Tank to rotate.
  * @param action Rotation action request.
  */
-void GM_209277367_322542887::rotate(TankInfo& tank, const ActionRequest action) {
+void GM_209277367_322542887::rotate(const int tank_index, const ActionRequest action) {
     // Get the current direction of the tank
-    Direction dir = tank.getDirection();
+    Direction dir = tanks_.getDirection(tank_index);
     Direction new_dir = dir;
 
     // Rotate the tank based on the action
     switch (action) {
         case ActionRequest::RotateLeft45:
-            new_dir = static_cast<Direction>((static_cast<int>(dir) - 1 + 8) % 8);
+            new_dir = rotateDirection(dir, -1);
             break;
         case ActionRequest::RotateRight45:
-            new_dir = static_cast<Direction>((static_cast<int>(dir) + 1) % 8);
+            new_dir = rotateDirection(dir, 1);
             break;
         case ActionRequest::RotateLeft90:
-            new_dir = static_cast<Direction>((static_cast<int>(dir) - 2 + 8) % 8);
+            new_dir = rotateDirection(dir, -2);
             break;
         case ActionRequest::RotateRight90:
-            new_dir = static_cast<Direction>((static_cast<int>(dir) + 2) % 8);
+            new_dir = rotateDirection(dir, 2);
             break;
         default:
             break; // No rotation
     }
 
-    tank.setDirection(new_dir); // Update tanks direction
+    toggleTankHash(tank_index);
+    tanks_.setDirection(tank_index, new_dir); // Update tanks direction
+    toggleTankHash(tank_index);
 }
 
 /**
@@ -315,21 +614,21 @@ void GM_209277367_322542887::rotate(TankInfo& tank, const ActionRequest action)
  * Includes timing and flag management for backward movement delays, cooldowns,
  * and invalid action handling. Also supports retrieving battle info for the tank.
  *
- * @param action The action to perform.
- * @param tank   Reference to the tank performing the action.
+ * @param action     The action to perform.
+ * @param tank_index Index of the tank performing the action.
  * @return true if the action was successfully executed or valid, false otherwise.
  *
  * @note
  * - Backward movement may require a delay before execution.
  * - Invalid actions still reduce the shooting cooldown.
- * - GetBattleInfo temporarily modifies the gameboard to mark the tank’s position
- *   before restoring it.
+ * - GetBattleInfo never writes the gameboard: the player gets a view of the start-of-turn
+ *   snapshot that reports the tank's own cell as '%' (see sendBattleInfo()).
  */
-bool GM_209277367_322542887::performAction(const ActionRequest action, TankInfo& tank) {
+bool GM_209277367_322542887::performAction(const ActionRequest action, const int tank_index) {
     // Deal with moving backwards
-    if (tank.justMovedBackwards() && action == ActionRequest::MoveBackward){ // If the tank just moved backwards
-        if (isValidAction(tank, ActionRequest::MoveBackward)) { // Check if the action is valid
-            moveTank(tank, ActionRequest::MoveBackward);
+    if (tanks_.justMovedBackwards(tank_index) && action == ActionRequest::MoveBackward){ // If the tank just moved backwards
+        if (isValidAction(tank_index, ActionRequest::MoveBackward)) { // Check if the action is valid
+            moveTank(tank_index, ActionRequest::MoveBackward);
             return true;
         }
 
@@ -337,78 +636,81 @@ bool GM_209277367_322542887::performAction(const ActionRequest action, TankInfo&
     }
 
     // Check if tank was moving backwards but now performing other action
-    if (tank.justMovedBackwards() &&
-        action != ActionRequest::MoveBackward) { tank.switchJustMovedBackwardsFlag(); }
+    if (tanks_.justMovedBackwards(tank_index) &&
+        action != ActionRequest::MoveBackward) { tanks_.switchJustMovedBackwardsFlag(tank_index); }
 
-    if (action == ActionRequest::MoveBackward && !tank.isMovingBackwards()) { // If tank now starting to move backwards
-        if (tank.justMovedBackwards()){ tank.zeroTurnsToBackwards(); } // Can immediately move backwards
-        tank.switchBackwardsFlag();
+    if (action == ActionRequest::MoveBackward && !tanks_.isMovingBackwards(tank_index)) { // If tank now starting to move backwards
+        if (tanks_.justMovedBackwards(tank_index)){ tanks_.zeroTurnsToBackwards(tank_index); } // Can immediately move backwards
+        tanks_.switchBackwardsFlag(tank_index);
     }
 
-    if (tank.isMovingBackwards()){ // If tank is moving backwards
-        tank.decreaseTurnsToShoot(); // Decrease turns to shoot anyway
+    if (tanks_.isMovingBackwards(tank_index)){ // If tank is moving backwards
+        tanks_.decreaseTurnsToShoot(tank_index); // Decrease turns to shoot anyway
 
         if (action == ActionRequest::MoveForward) { // Tank wants to cancel backwards move
-            tank.switchBackwardsFlag(); // No longer wants to move backwards
-            tank.restartTurnsToBackwards();
+            tanks_.switchBackwardsFlag(tank_index); // No longer wants to move backwards
+            tanks_.restartTurnsToBackwards(tank_index);
             return false;
         }
 
-        if (tank.getTurnsToBackwards() == 0) { // If tank is now eligible to move backwards
-            if (isValidAction(tank, ActionRequest::MoveBackward)) { // Check if the action is valid
-                moveTank(tank, ActionRequest::MoveBackward);
-                tank.switchJustMovedBackwardsFlag();
+        if (tanks_.getTurnsToBackwards(tank_index) == 0) { // If tank is now eligible to move backwards
+            if (isValidAction(tank_index, ActionRequest::MoveBackward)) { // Check if the action is valid
+                moveTank(tank_index, ActionRequest::MoveBackward);
+                tanks_.switchJustMovedBackwardsFlag(tank_index);
             }
 
-            tank.restartTurnsToBackwards();
-            tank.switchBackwardsFlag();
+            tanks_.restartTurnsToBackwards(tank_index);
+            tanks_.switchBackwardsFlag(tank_index);
             return false; // Tanks moves, but registered action is ignored
         }
 
         bool succ;
-        if (tank.getTurnsToBackwards() == 2 ) { succ = true; }// Just requested backwards, which is valid
+        if (tanks_.getTurnsToBackwards(tank_index) == 2 ) { succ = true; }// Just requested backwards, which is valid
         else { succ = false; } // Still waiting for backwards move, current action is ignored
 
-        tank.decreaseTurnsToBackwards(); // Decrease turns to backwards
+        tanks_.decreaseTurnsToBackwards(tank_index); // Decrease turns to backwards
 
         return succ;
     }
 
-    if (!isValidAction(tank, action)) { // Check if the action is valid
-        tank.decreaseTurnsToShoot(); // Decrease turns to shoot if action is invalid
-        // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Invalid action: " << getEnumName(action) << endl;
+    if (!isValidAction(tank_index, action)) { // Check if the action is valid
+        tanks_.decreaseTurnsToShoot(tank_index); // Decrease turns to shoot if action is invalid
+        // cout << "Tank " << tanks_.getPlayerId(tank_index) << "." << tanks_.getID(tank_index) << " Invalid action: " << getEnumName(action) << endl;
         return false;
     }
 
     // Perform the action based on the action type
     switch (action) {
         case ActionRequest::MoveForward:
-            moveTank(tank, action);
-            tank.decreaseTurnsToShoot();
+            moveTank(tank_index, action);
+            tanks_.decreaseTurnsToShoot(tank_index);
             break;
         case ActionRequest::Shoot:
-            shoot(tank); // Perform the shoot action
+            shoot(tank_index); // Perform the shoot action
             break;
         case ActionRequest::DoNothing:
-            tank.decreaseTurnsToShoot();
+            tanks_.decreaseTurnsToShoot(tank_index);
             break;
         case ActionRequest::MoveBackward:
             break;
 
         case ActionRequest::GetBattleInfo: { // Get battle info
-            auto* player = (tank.getPlayerId() == 1 ? player1_ : player2_); // Get the player based on tank ID
-            TankAlgorithm& tank_algo = *tank.getTank(); // Get the tank algorithm
-            const char curr_loc = lastRoundGameboard_[tank.getLocation().second][tank.getLocation().first]; // Get the current tank location
-            lastRoundGameboard_[tank.getLocation().second][tank.getLocation().first] = '%'; // Update the gameboard with the tank's position
-            const auto satellite_view = make_unique<ExtSatelliteView>(width_, height_, lastRoundGameboard_); // Create a new satellite view
-            player->updateTankWithBattleInfo(tank_algo, *satellite_view);
-            lastRoundGameboard_[tank.getLocation().second][tank.getLocation().first] = curr_loc; // Restore the tank's position on the gameboard
-            tank.decreaseTurnsToShoot();
+            PhaseScope phase(phaseTimer_, ExtGameResult::BATTLE_INFO);
+            if (callbackPool_) { // Parallel mode - delivered by deliverBattleInfo() after the action phase
+                syncLastRoundGameboard();
+                battleInfoRequests_.emplace_back(tank_index, tanks_.getLocation(tank_index));
+                tanks_.decreaseTurnsToShoot(tank_index);
+                break;
+            }
+            auto* player = (tanks_.getPlayerId(tank_index) == 1 ? player1_ : player2_); // Get the player based on tank ID
+            syncLastRoundGameboard(); // Bring the start-of-turn snapshot up to date
+            sendBattleInfo(*player, tank_index, tanks_.getLocation(tank_index));
+            tanks_.decreaseTurnsToShoot(tank_index);
             break; }
 
         default: // Rotate tank
-            rotate(tank, action);
-            tank.decreaseTurnsToShoot();
+            rotate(tank_index, action);
+            tanks_.decreaseTurnsToShoot(tank_index);
             break;
     }
 
@@ -418,34 +720,90 @@ bool GM_209277367_322542887::performAction(const ActionRequest action, TankInfo&
 /**
  * @brief Executes the queued actions for all alive tanks.
  *
- * Iterates over @c tanks_, and for each alive tank calls @c performAction
+ * Iterates over the live tanks, and for each one still alive calls @c performAction
  * with the corresponding entry in @c tankActions_. If execution fails,
  * marks the action’s validity flag (second of the pair) as false.
  *
  * @note Expects @c tankActions_ to be aligned with @c tanks_ and
  *       pre-populated (e.g., by @c getTankActions()).
+ * @note Board writes made here are journaled so a later GetBattleInfo in the
+ *       same turn still sees the start-of-turn board.
  *
  * @return void
  */
 void GM_209277367_322542887::performTankActions() {
-    // Iterate through all tanks
-    for (size_t i = 0; i < tanks_.size(); ++i) {
+    // Journal board writes until the turn's snapshot is taken (see syncLastRoundGameboard)
+    turnJournal_.clear();
+    journalWrites_ = true;
+
+    // Iterate through the live tanks - killing a tank keeps it listed until the end of the turn
+    for (const int i : tanks_.live()) {
 
-        // std::cout << "Tank " << tanks_[i]->getPlayerId() << "." << tanks_[i]->getID() << " Performing action: " <<
+        // std::cout << "Tank " << tanks_.getPlayerId(i) << "." << tanks_.getID(i) << " Performing action: " <<
         //    getEnumName(tankActions_[i].first) << endl;
 
-        if (tanks_[i]->getIsAlive() == 0) {
-            bool succ = performAction(tankActions_[i].first, *tanks_[i]);
+        if (tanks_.getIsAlive(i) == 0) {
+            bool succ = performAction(tankActions_[i].first, i);
             if (!succ) { tankActions_[i].second = false; }
         }
     }
+
+    journalWrites_ = false; // No battle info can be requested after the action phase
+    if (!battleInfoRequests_.empty()) {
+        PhaseScope phase(phaseTimer_, ExtGameResult::BATTLE_INFO);
+        deliverBattleInfo();
+    }
+}
+
+/**
+ * @brief Delivers the battle info requested during the action phase (parallel mode).
+ *
+ * Each player gets its requests in tank order, as views of the start-of-turn snapshot with
+ * the requesting tank shown as '%'; the two players are served concurrently unless they are
+ * the same object. Deferring the delivery is invisible to the game: the views show the start
+ * of the turn either way, and the algorithms are not called again before the next turn.
+ */
+void GM_209277367_322542887::deliverBattleInfo() {
+    const auto deliver = [this](const Player* player) {
+        for (const auto& [tank, location] : battleInfoRequests_) {
+            Player* owner = (tanks_.getPlayerId(tank) == 1) ? player1_ : player2_;
+            if (player == nullptr || owner == player) { sendBattleInfo(*owner, tank, location); }
+        }
+    };
+    if (player1_ == player2_) { deliver(nullptr); } // Shared player - serve all requests in order
+    else { callbackPool_->run(2, [&](const size_t i) { deliver(i == 0 ? player1_ : player2_); }); }
+
+    battleInfoRequests_.clear();
+}
+
+/**
+ * @brief Hands one tank's battle info to its player.
+ *
+ * The player gets a DeltaSatelliteView of the start-of-turn snapshot (which must be synced)
+ * with the tank shown as '%', plus the cells changed since the player's previous view.
+ * Neither the board nor the change list is copied. Players shared by both sides share one
+ * change list.
+ *
+ * @param player     The tank's player.
+ * @param tank_index The requesting tank.
+ * @param location   The tank's location at the start of the turn.
+ */
+void GM_209277367_322542887::sendBattleInfo(Player& player, const int tank_index, const pair<int, int> location) {
+    const auto [x, y] = location;
+    BattleInfoDelta& delta = battleInfoDeltas_[(player1_ == player2_) ? 0 : tanks_.getPlayerId(tank_index) - 1];
+    const size_t overlay = lastRoundGameboard_.index(x, y);
+
+    DeltaSatelliteView satellite_view(lastRoundGameboard_, x, y, '%', delta.changesFor(overlay));
+    player.updateTankWithBattleInfo(tanks_.getTank(tank_index), satellite_view);
+    delta.delivered(overlay);
 }
 
 /**
  * @brief Checks the current status of all tanks and updates game state flags.
  *
- * Counts remaining alive tanks, checks for ammo depletion, and determines
- * if the game is over due to no tanks left or one player losing all tanks.
+ * Reads the per-player alive and out-of-ammo counters (kept up to date by
+ * killTank() and shoot()) and determines if the game is over due to no tanks
+ * left or one player losing all tanks. O(1) regardless of the number of tanks.
  * Updates flags such as @c noAmmoFlag_, @c gameOver_, and @c gameOverStatus_,
  * as well as player tank counts for logging.
  *
@@ -454,13 +812,15 @@ void GM_209277367_322542887::performTankActions() {
  *   - 1: Player 1 lost all tanks
  *   - 2: Player 2 lost all tanks
  *   - 3: No tanks left for either player
+ *   - 4: The game repeats a cycle (set by detectCycle())
+ *   - 5: A player forfeited (set by playTurn(), see setActionBudget())
  * - @c noAmmoFlag_ is set if all remaining tanks have zero ammo.
  */
 void GM_209277367_322542887::checkTanksStatus() {
-    const size_t tank_count = tanks_.size() - destroyedTanksIndices_.size();
-    size_t no_ammo_count = 0;
-    size_t player_1_count = 0;
-    size_t player_2_count = 0;
+    const size_t player_1_count = aliveTanks_[0];
+    const size_t player_2_count = aliveTanks_[1];
+    const size_t tank_count = player_1_count + player_2_count;
+    const size_t no_ammo_count = outOfAmmoTanks_[0] + outOfAmmoTanks_[1];
 
     if (tank_count == 0) { // Check not tanks are left
         gameOver_ = true;
@@ -468,18 +828,6 @@ void GM_209277367_322542887::checkTanksStatus() {
         return;
     }
 
-    for (const auto & tank : tanks_) { // Check if tanks are out of ammo
-        if (tank->getIsAlive() == 0 && tank->getAmmo() <= 0) {
-            ++no_ammo_count;
-        }
-
-        if (tank->getPlayerId() == 1 && tank->getIsAlive() == 0) { // Found player 1's tank
-            ++player_1_count;
-        } else if (tank->getPlayerId() == 2 && tank->getIsAlive() == 0) { // Found player 2's tank
-            ++player_2_count;
-        }
-    }
-
     if (no_ammo_count == tank_count) { noAmmoFlag_ = true; } // If tanks are out of ammo, set flag
     if (player_1_count == 0) { // If player 1 is out of tanks
         gameOverStatus_ = 1;
@@ -499,88 +847,225 @@ void GM_209277367_322542887::checkTanksStatus() {
 /**
  * @brief Finds the index of a tank located at the given coordinates.
  *
- * Iterates through @c tanks_ to match the given (x, y) position with a tank's location.
+ * Looks the cell up in @c tankGrid_, which holds the lowest @c tanks_ index located
+ * there - the same tank a front-to-back scan of @c tanks_ would find first.
  *
  * @param x X-coordinate to search.
  * @param y Y-coordinate to search.
  * @return Tank index if found, -1 if no tank is at the given location.
  */
 int GM_209277367_322542887::getTankIndexAt(int x, int y) const {
-    const pair<int, int> tank_loc = make_pair(x, y);
+    return tankGrid_.at(gameboard_.index(x, y));
+}
 
-    for (int i = 0; i < static_cast<int>(tanks_.size()); ++i) { // Check if tank is at location
-        if (tanks_[i]->getLocation() == tank_loc) {
-            return i;
-        }
+/**
+ * @brief Moves a tank to (x, y), keeping @c tankGrid_ in sync.
+ *
+ * @param tank_index Index of the tank in @c tanks_.
+ * @param x          Target x-coordinate.
+ * @param y          Target y-coordinate.
+ */
+void GM_209277367_322542887::relocateTank(const int tank_index, const int x, const int y) {
+    auto [old_x, old_y] = tanks_.getLocation(tank_index);
+    tankGrid_.remove(gameboard_.index(old_x, old_y), tank_index,
+        [&](const int from) { return nextTankIndexAt(old_x, old_y, from); });
+
+    toggleTankHash(tank_index);
+    tanks_.setLocation(tank_index, x, y);
+    tankGrid_.add(gameboard_.index(x, y), tank_index);
+    toggleTankHash(tank_index);
+}
+
+/**
+ * @brief Destroys a tank.
+ *
+ * Unregisters it from @c tankGrid_, marks it destroyed, updates the per-player
+ * alive / out-of-ammo counters and marks it as killed this turn (which also moves it
+ * off the board). It stays in the live list until updateGameLog() retires it.
+ *
+ * @param tank_index Index of the tank in @c tanks_.
+ */
+void GM_209277367_322542887::killTank(const int tank_index) {
+    if (auto [x, y] = tanks_.getLocation(tank_index); x >= 0 && y >= 0) {
+        tankGrid_.remove(gameboard_.index(x, y), tank_index,
+            [&](const int from) { return nextTankIndexAt(x, y, from); });
+    }
+
+    if (!tanks_.isDestroyed(tank_index)) {
+        toggleTankHash(tank_index); // Still at its last location
+        tanks_.setDestroyed(tank_index);
+        const int player_index = tanks_.getPlayerId(tank_index) - 1;
+        --aliveTanks_[player_index];
+        if (tanks_.getAmmo(tank_index) <= 0) { --outOfAmmoTanks_[player_index]; }
     }
-    return -1; // Tank not found
+    tanks_.increaseTurnsDead(tank_index);
 }
 
 /**
- * @brief Retrieves an iterator to the shell at the specified coordinates.
+ * @brief Scans the live tanks after index @p from for a tank located at (x, y).
  *
- * Searches through @c shells_ for a shell whose location matches (x, y).
+ * Only used when several tanks share a cell and the lowest of them leaves it. Tanks off
+ * the live list are dead and located at (-1, -1), so they never match.
  *
- * @param x X-coordinate to search.
- * @param y Y-coordinate to search.
- * @return Iterator to the matching shell, or @c shells_.end() if not found.
+ * @return Index of the next tank at (x, y), or -1 if none.
  */
-ShellIterator GM_209277367_322542887::getShellAt(const int x, const int y) {
-    for (auto it = shells_.begin(); it != shells_.end(); ++it) { // Check if shell is at location
-        if (auto [fst, snd] = (*it)->getLocation(); fst == x && snd == y) {
-            return it;
-        }
+int GM_209277367_322542887::nextTankIndexAt(const int x, const int y, const int from) const {
+    const vector<int>& live = tanks_.live();
+    for (auto it = std::upper_bound(live.begin(), live.end(), from); it != live.end(); ++it) {
+        if (auto [tx, ty] = tanks_.getLocation(*it); tx == x && ty == y) { return *it; }
     }
+    return -1;
+}
 
-    return shells_.end(); // Return end iterator if no shell found
+/**
+ * @brief Retrieves the slot of the shell at the specified coordinates.
+ *
+ * Looks the cell up in @c shellGrid_, which holds the lowest live @c shells_ slot located
+ * there - the same shell a front-to-back scan of @c shells_ would find first.
+ *
+ * @param x X-coordinate to search.
+ * @param y Y-coordinate to search.
+ * @return Slot of the matching shell, or -1 if not found.
+ */
+int GM_209277367_322542887::getShellAt(const int x, const int y) const {
+    return shellGrid_.at(gameboard_.index(x, y));
 }
 
 /**
  * @brief Removes a shell from the game.
  *
- * Erases the shell at the given iterator position in @c shells_.
+ * Unregisters the shell from @c shellGrid_ and tombstones its slot in @c shells_;
+ * the other shells keep their slots until the next checkShellsCollide().
  *
- * @param it Iterator pointing to the shell to remove.
- * @return Iterator to the next element after the erased shell.
+ * @param slot Slot of the shell to remove.
+ * @return Slot of the next live shell after the removed one (@c shells_.slots() if none).
  */
-ShellIterator GM_209277367_322542887::deleteShell(ShellIterator it) {
-    if (it != shells_.end()) {
-        it = shells_.erase(it); // Remove the shell from the vector
+int GM_209277367_322542887::deleteShell(const int slot) {
+    if (slot != -1) {
+        const int x = shells_.getX(slot);
+        const int y = shells_.getY(slot);
+        shellGrid_.remove(gameboard_.index(x, y), slot,
+            [&](const int from) { return nextShellSlotAt(x, y, from); });
+        toggleShellHash(slot);
+        shells_.kill(slot); // Tombstone the slot
     }
 
-    return it;
+    return shells_.nextAlive(slot + 1);
+}
+
+/**
+ * @brief Adds a new shell to @c shells_ and registers it in @c shellGrid_.
+ *
+ * @param x   X-coordinate of the shell.
+ * @param y   Y-coordinate of the shell.
+ * @param dir Direction the shell travels in.
+ * @return Slot of the new shell.
+ */
+int GM_209277367_322542887::spawnShell(const int x, const int y, const Direction dir) {
+    const int slot = shells_.spawn(x, y, dir);
+    shellGrid_.add(gameboard_.index(x, y), slot);
+    toggleShellHash(slot);
+    return slot;
+}
+
+/**
+ * @brief Moves a shell to (x, y), keeping @c shellGrid_ in sync.
+ *
+ * @param slot Slot of the shell being moved.
+ * @param x    Target x-coordinate.
+ * @param y    Target y-coordinate.
+ */
+void GM_209277367_322542887::moveShellTo(const int slot, const int x, const int y) {
+    const int old_x = shells_.getX(slot);
+    const int old_y = shells_.getY(slot);
+
+    shellGrid_.remove(gameboard_.index(old_x, old_y), slot,
+        [&](const int from) { return nextShellSlotAt(old_x, old_y, from); });
+    toggleShellHash(slot);
+    shells_.setLocation(slot, x, y);
+    shellGrid_.add(gameboard_.index(x, y), slot);
+    toggleShellHash(slot);
+}
+
+/**
+ * @brief Sets whether a shell sits on top of a mine, keeping @c stateHash_ in sync.
+ *
+ * @param slot  Slot of the shell.
+ * @param above Whether the shell is above a mine.
+ */
+void GM_209277367_322542887::setShellAboveMine(const int slot, const bool above) {
+    toggleShellHash(slot);
+    shells_.setAboveMine(slot, above);
+    toggleShellHash(slot);
+}
+
+/**
+ * @brief Toggles an alive tank's key (index, cell, direction) in @c stateHash_.
+ *
+ * Called once before and once after every change to the tank's location or direction.
+ *
+ * @param tank_index Index of the tank in @c tanks_.
+ */
+void GM_209277367_322542887::toggleTankHash(const int tank_index) {
+    const auto [x, y] = tanks_.getLocation(tank_index);
+    stateHash_.toggleTank(tank_index, gameboard_.index(x, y), tanks_.getDirection(tank_index));
+}
+
+/**
+ * @brief Toggles a live shell's key (cell, direction, above-mine flag) in @c stateHash_.
+ *
+ * Called once before and once after every change to the shell, and once when it is
+ * spawned or removed.
+ *
+ * @param slot Slot of the shell.
+ */
+void GM_209277367_322542887::toggleShellHash(const int slot) {
+    stateHash_.toggleShell(gameboard_.index(shells_.getX(slot), shells_.getY(slot)),
+        shells_.getDirection(slot), shells_.isAboveMine(slot));
+}
+
+/**
+ * @brief Scans @c shells_ after slot @p from for a live shell located at (x, y).
+ *
+ * Only used when several shells share a cell and the lowest of them leaves it.
+ *
+ * @return Slot of the next shell at (x, y), or -1 if none.
+ */
+int GM_209277367_322542887::nextShellSlotAt(const int x, const int y, const int from) const {
+    for (int i = from + 1; i < shells_.slots(); ++i) {
+        if (shells_.isAlive(i) && shells_.getX(i) == x && shells_.getY(i) == y) { return i; }
+    }
+    return -1;
 }
 
 /**
  * @brief Updates the position of all shells and resolves interactions.
  *
- * Iterates over the provided list of shells, moving each one based on its
+ * Iterates over the live slots of @c shells_ in order, moving each shell based on its
  * direction and handling collisions or interactions with tanks, other shells,
  * and various map objects.
  *
- * @param shells Reference to the vector of active shells.
- *
  * @note
  * - Calls helper functions to handle spawning on a tank, clearing the previous position,
  *   resolving collisions with other shells, or moving into the next cell.
- * - May remove shells from the list during iteration.
+ * - May remove shells (tombstone their slots) during iteration.
  */
-void GM_209277367_322542887::moveShells(std::vector<std::unique_ptr<Shell>>& shells) {
-    for (auto it = shells.begin(); it != shells.end();) {
-        Shell& shell = **it;
-        auto [x, y] = shell.getLocation();
-        Direction dir = shell.getDirection();
+void GM_209277367_322542887::moveShells() {
+    for (int slot = shells_.nextAlive(0); slot < shells_.slots();) {
+        const int x = shells_.getX(slot);
+        const int y = shells_.getY(slot);
+        Direction dir = shells_.getDirection(slot);
         auto [new_x, new_y] = nextLocation(x, y, dir);
-        const char next_cell = gameboard_[new_y][new_x];
+        const char next_cell = gameboard_.at(new_x, new_y);
 
-        if (handleShellSpawnOnTank(shell, it)) continue;
+        if (handleShellSpawnOnTank(slot)) continue;
 
-        clearPreviousShellPosition(shell);
+        clearPreviousShellPosition(slot);
 
         if (next_cell == '*') {
-            if (handleShellCollision(shell, new_x, new_y, dir, it)) return;
+            if (handleShellCollision(new_x, new_y, dir, slot)) return;
         } else {
-            handleShellMoveToNextCell(shell, new_x, new_y, next_cell, it);
+            handleShellMoveToNextCell(new_x, new_y, next_cell, slot);
         }
     }
 }
@@ -594,20 +1079,22 @@ void GM_209277367_322542887::moveShells(std::vector<std::unique_ptr<Shell>>& she
  * - If overlapping a damaged tank ('a' or 'b'), restores the original tank ('1' or '2').
  * - Otherwise, clears the cell to an empty space unless it holds a tank or mine.
  *
- * @param shell Reference to the shell whose previous position is being cleared.
+ * @param slot Slot of the shell whose previous position is being cleared.
  */
-void GM_209277367_322542887::clearPreviousShellPosition(Shell& shell) {
-    auto [x, y] = shell.getLocation();
-
-    if (shell.isAboveMine()) {
-        gameboard_[y][x] = '@';
-        shell.setAboveMine(false);
-    } else if (gameboard_[y][x] == '^') {
-        gameboard_[y][x] = '*';
-    } else if (gameboard_[y][x] == 'a' || gameboard_[y][x] == 'b') {
-        gameboard_[y][x] = (gameboard_[y][x] == 'a') ? '1' : '2';
-    } else if (gameboard_[y][x] != '1' && gameboard_[y][x] != '2' && gameboard_[y][x] != '@') {
-        gameboard_[y][x] = ' ';
+void GM_209277367_322542887::clearPreviousShellPosition(const int slot) {
+    const int x = shells_.getX(slot);
+    const int y = shells_.getY(slot);
+    const char cell = gameboard_.at(x, y);
+
+    if (shells_.isAboveMine(slot)) {
+        setCell(x, y, '@');
+        setShellAboveMine(slot, false);
+    } else if (cell == '^') {
+        setCell(x, y, '*');
+    } else if (cell == 'a' || cell == 'b') {
+        setCell(x, y, (cell == 'a') ? '1' : '2');
+    } else if (cell != '1' && cell != '2' && cell != '@') {
+        setCell(x, y, ' ');
     }
 }
 
@@ -617,20 +1104,19 @@ void GM_209277367_322542887::clearPreviousShellPosition(Shell& shell) {
  * Checks if the shell's current position corresponds to a destroyed tank marker ('c' or 'd').
  * If so, marks the tank as destroyed, updates its state, clears the board cell, and removes the shell.
  *
- * @param shell Reference to the shell being processed.
- * @param it Iterator pointing to the shell in @c shells_.
+ * @param slot Slot of the shell being processed; advanced to the next live shell if removed.
  * @return true if a shell-tank spawn collision was handled and the shell removed, false otherwise.
  */
-bool GM_209277367_322542887::handleShellSpawnOnTank(Shell& shell, ShellIterator& it) {
-    auto [x, y] = shell.getLocation();
-    char cell = gameboard_[y][x];
+bool GM_209277367_322542887::handleShellSpawnOnTank(int& slot) {
+    const int x = shells_.getX(slot);
+    const int y = shells_.getY(slot);
+    char cell = gameboard_.at(x, y);
     if (cell == 'c' || cell == 'd') {
         int tank_index = getTankIndexAt(x, y);
         if (tank_index != -1) {
-            destroyedTanksIndices_.insert(tank_index);
-            tanks_[tank_index]->increaseTurnsDead();
-            gameboard_[y][x] = ' ';
-            it = shells_.erase(it);
+            killTank(tank_index);
+            setCell(x, y, ' ');
+            slot = deleteShell(slot);
             return true;
         }
     }
@@ -642,39 +1128,34 @@ bool GM_209277367_322542887::handleShellSpawnOnTank(Shell& shell, ShellIterator&
  *
  * If the two shells move in opposite directions, removes both shells
  * and clears the board cell. Otherwise, stacks the shells at (x, y)
- * by marking '^' and advances the iterator.
+ * by marking '^' and advances to the next shell.
  *
- * @param shell The active shell being advanced.
  * @param x     Target x-coordinate.
  * @param y     Target y-coordinate.
  * @param dir   Direction of the active shell.
- * @param it    Iterator to the active shell; updated if erased.
+ * @param slot  Slot of the active shell; updated to the shell to process next.
  * @return true if @c shells_ becomes empty after handling the collision, false otherwise.
  */
-bool GM_209277367_322542887::handleShellCollision(Shell& shell, int x, int y, Direction dir, ShellIterator& it) {
-    ShellIterator other_shell_it = getShellAt(x, y);
-    Direction other_dir = (*other_shell_it)->getDirection();
-
-    auto areOppositeDirections = [](Direction d1, Direction d2) {
-        return static_cast<int>(d1) == (static_cast<int>(d2) + 4) % 8;
-    };
+bool GM_209277367_322542887::handleShellCollision(int x, int y, Direction dir, int& slot) {
+    const int other_slot = getShellAt(x, y);
+    Direction other_dir = shells_.getDirection(other_slot);
 
     if (areOppositeDirections(dir, other_dir)) {
-        gameboard_[y][x] = ' ';
+        setCell(x, y, ' ');
 
-        if (it < other_shell_it) {
-            deleteShell(other_shell_it);
-            it = shells_.erase(it);
+        if (slot < other_slot) {
+            deleteShell(other_slot);
+            slot = deleteShell(slot);
         } else {
-            shells_.erase(it);
-            it = deleteShell(other_shell_it);
+            deleteShell(slot);
+            slot = deleteShell(other_slot); // Resume right after the other shell
         }
 
         return shells_.empty();
     } else {
-        shell.setLocation(x, y);
-        gameboard_[y][x] = '^';
-        ++it;
+        moveShellTo(slot, x, y);
+        setCell(x, y, '^');
+        slot = shells_.nextAlive(slot + 1);
         return false;
     }
 }
@@ -686,50 +1167,48 @@ bool GM_209277367_322542887::handleShellCollision(Shell& shell, int x, int y, Di
  * - '#': weaken wall to '$' and remove the shell.
  * - '$': destroy wall (set to space) and remove the shell.
  * - '1'/'2': destroy the tank at (x, y), clear the cell, and remove the shell.
- * - '@': place shell above a mine (mark '*', set above-mine flag), advance iterator.
+ * - '@': place shell above a mine (mark '*', set above-mine flag).
  * - ' ': move shell to (x, y) and mark '*'.
- * - default: no special handling; advance iterator.
+ * - default: no special handling.
  *
- * @param shell   The shell being advanced.
  * @param x       Target x-coordinate.
  * @param y       Target y-coordinate.
  * @param next_cell Board symbol at (x, y).
- * @param it      Iterator to the shell; may be updated if erased.
+ * @param slot    Slot of the shell being advanced; updated to the shell to process next.
  */
-void GM_209277367_322542887::handleShellMoveToNextCell(Shell& shell, int x, int y, char next_cell, ShellIterator& it) {
+void GM_209277367_322542887::handleShellMoveToNextCell(int x, int y, char next_cell, int& slot) {
     switch (next_cell) {
         case '#':
-            gameboard_[y][x] = '$';
-            it = shells_.erase(it);
+            setCell(x, y, '$');
+            slot = deleteShell(slot);
             break;
         case '$':
-            gameboard_[y][x] = ' ';
-            it = shells_.erase(it);
+            setCell(x, y, ' ');
+            slot = deleteShell(slot);
             break;
         case '1':
         case '2': {
             int tank_index = getTankIndexAt(x, y);
             if (tank_index != -1) {
-                destroyedTanksIndices_.insert(tank_index);
-                tanks_[tank_index]->increaseTurnsDead();
-                gameboard_[y][x] = ' ';
-                it = shells_.erase(it);
+                killTank(tank_index);
+                setCell(x, y, ' ');
+                slot = deleteShell(slot);
             }
             break;
         }
         case '@':
-            shell.setLocation(x, y);
-            gameboard_[y][x] = '*';
-            shell.setAboveMine(true);
-            ++it;
+            moveShellTo(slot, x, y);
+            setCell(x, y, '*');
+            setShellAboveMine(slot, true);
+            slot = shells_.nextAlive(slot + 1);
             break;
         case ' ':
-            shell.setLocation(x, y);
-            gameboard_[y][x] = '*';
-            ++it;
+            moveShellTo(slot, x, y);
+            setCell(x, y, '*');
+            slot = shells_.nextAlive(slot + 1);
             break;
         default:
-            ++it;
+            slot = shells_.nextAlive(slot + 1);
             break;
     }
 }
@@ -737,32 +1216,215 @@ void GM_209277367_322542887::handleShellMoveToNextCell(Shell& shell, int x, int
 /**
  * @brief Collapses shells that occupy the same cell and updates the board.
  *
- * Groups shells by their (x,y) location. If only one shell exists at a cell,
- * it is kept; if multiple shells share a cell, they are all removed and the
- * board cell is cleared to space.
+ * Counts the live shells per cell: if only one shell exists at a cell, it is kept;
+ * if multiple shells share a cell, they are all removed and the board cell is cleared
+ * to space. The per-cell counters are generation-stamped, so they never need clearing,
+ * and all scratch storage is reused - the pass does not allocate.
  *
- * @note Rebuilds @c shells_ from the grouped map, removing collided shells.
+ * @note Compacts @c shells_ (dropping tombstones and collided shells) in (x, y) order,
+ *       and re-registers the survivors in @c shellGrid_.
  */
 void GM_209277367_322542887::checkShellsCollide() {
-    map<pair<int, int>, vector<unique_ptr<Shell>>> shell_map;
+    ++shellCountStamp_; // Invalidates every counter from the previous pass
+
+    // Count the shells per cell
+    for (int slot = 0; slot < shells_.slots(); ++slot) {
+        if (!shells_.isAlive(slot)) continue;
+        const size_t cell = gameboard_.index(shells_.getX(slot), shells_.getY(slot));
+        if (shellCountStampAt_[cell] != shellCountStamp_) {
+            shellCountStampAt_[cell] = shellCountStamp_;
+            shellCount_[cell] = 0;
+            shellGrid_.clear(cell); // Surviving shells are re-registered below
+        }
+        ++shellCount_[cell];
+    }
 
-    // Create a map to store shells by location
-    for (auto& shell : shells_) {
-        pair<int, int> loc = shell->getLocation();
-        shell_map[loc].emplace_back(std::move(shell));
+    // Keep lone shells, clear the cells where shells collided
+    shellSurvivors_.clear();
+    for (int slot = 0; slot < shells_.slots(); ++slot) {
+        if (!shells_.isAlive(slot)) continue;
+        const int x = shells_.getX(slot);
+        const int y = shells_.getY(slot);
+        if (shellCount_[gameboard_.index(x, y)] == 1) {
+            shellSurvivors_.push_back(slot);
+        } else {
+            setCell(x, y, ' ');
+            toggleShellHash(slot); // Collided - dropped by compact() below
+        }
     }
 
-    shells_.clear(); // Clear the shells vector of nullptrs
+    compactShellsInCellOrder();
+}
 
-    // Iterate over the map to check for collisions
-    for (auto& [loc, shell_lst] : shell_map) {
-        if (shell_lst.size() == 1) {
-            shells_.emplace_back(std::move(shell_lst[0]));
-        }
-        else {
-            gameboard_[loc.second][loc.first] = ' ';
+/**
+ * @brief Keeps only the shells in @c shellSurvivors_, stored in (x, y) order.
+ *
+ * Sorts @c shellSurvivors_, compacts @c shells_ to those slots (they become slots
+ * 0..n-1) and registers them in @c shellGrid_, whose cells must have been cleared.
+ * Survivors are processed in (x, y) order from then on.
+ */
+void GM_209277367_322542887::compactShellsInCellOrder() {
+    std::sort(shellSurvivors_.begin(), shellSurvivors_.end(), [this](const int a, const int b) {
+        return std::make_pair(shells_.getX(a), shells_.getY(a)) < std::make_pair(shells_.getX(b), shells_.getY(b));
+    });
+
+    for (int i = 0; i < static_cast<int>(shellSurvivors_.size()); ++i) {
+        const int slot = shellSurvivors_[i];
+        shellGrid_.add(gameboard_.index(shells_.getX(slot), shells_.getY(slot)), i);
+    }
+
+    shells_.compact(shellSurvivors_);
+}
+
+/**
+ * @brief Plays the shell phase of a turn - two half steps of moveShells() then checkShellsCollide().
+ *
+ * Tries the fused kernel for both half steps at once first. Otherwise each half step is played
+ * by the first of the fused kernel, the bit planes (if enabled) and the sequential rules that
+ * applies; all of them leave the same board, tanks and shells.
+ */
+void GM_209277367_322542887::advanceShells() {
+    if (advanceOpenShells(2)) { return; }
+
+    for (int half_step = 0; half_step < 2; ++half_step) {
+        if (advanceOpenShells(1) || advanceShellsWithBitboard()) { continue; }
+        moveShells(); // Move the shells
+        checkShellsCollide(); // Check for shell collisions
+    }
+}
+
+/**
+ * @brief Fused shell kernel: plays @p half_steps (1 or 2) half steps in one pass if every shell flies in open space.
+ *
+ * Applies when every shell sits alone on a plain '*' cell, every cell it enters is empty or a
+ * mine, no two shells enter the same cell, and in a second half step no shell enters a cell
+ * another shell is passing through (entering a cell another shell left is fine). No shell then
+ * affects another, so moveShells() would move them all and checkShellsCollide() would find no
+ * collision. The outcome is written back directly: vacated cells get their mine back or are
+ * cleared, each shell lands on its last cell (above a mine if there is one) and the shells are
+ * stored in (x, y) order. Cells passed through in the middle of two half steps end as they
+ * started and are not written.
+ * The paths are computed by a branch-free loop over the @c shells_ columns and the
+ * @c neighbors_ table; the conflict checks and the write-back only run after it.
+ *
+ * @param half_steps Number of half steps, 1 or 2.
+ * @return false, with nothing changed, if a shell may hit something or meet another shell.
+ */
+bool GM_209277367_322542887::advanceOpenShells(const int half_steps) {
+    if (!openShellKernel_) { return false; }
+    const int count = shells_.slots();
+    if (shells_.liveCount() != count) { return false; } // Tombstoned slots - left to moveShells()
+    if (count == 0) { return true; }
+
+    // Every shell's path, and whether its cells are open
+    shellFrom_.resize(count);
+    shellVia_.resize(count);
+    shellTo_.resize(count);
+    bool open = true;
+    for (int slot = 0; slot < count; ++slot) {
+        const Direction dir = shells_.getDirection(slot);
+        const int from = static_cast<int>(gameboard_.index(shells_.getX(slot), shells_.getY(slot)));
+        const int via = neighbors_->next(from, dir);
+        const char entered = gameboard_[via];
+        shellFrom_[slot] = from;
+        shellVia_[slot] = via;
+        shellTo_[slot] = (half_steps == 2) ? neighbors_->next(via, dir) : via;
+        open &= (gameboard_[from] == '*') & ((entered == ' ') | (entered == '@'));
+    }
+    if (!open) { return false; }
+
+    // Conflicts between the paths - each cell is marked with the part of a path it is on
+    enum PathMark { NONE, FROM, VIA, TO };
+    ++shellCountStamp_; // Reuses the checkShellsCollide counters
+    const auto mark = [this](const int cell, const PathMark path_mark) { // Returns the previous mark
+        const int previous = (shellCountStampAt_[cell] == shellCountStamp_) ? shellCount_[cell] : NONE;
+        shellCountStampAt_[cell] = shellCountStamp_;
+        shellCount_[cell] = path_mark;
+        return previous;
+    };
+    for (int slot = 0; slot < count; ++slot) {
+        if (mark(shellFrom_[slot], FROM) != NONE) { return false; } // Shells sharing a cell
+    }
+    for (int slot = 0; slot < count; ++slot) {
+        if (mark(shellVia_[slot], VIA) != NONE) { return false; } // Shells entering the same cell
+    }
+    if (half_steps == 2) {
+        for (int slot = 0; slot < count; ++slot) {
+            const int to = shellTo_[slot];
+            const int previous = mark(to, TO);
+            if (previous == VIA || previous == TO) { return false; } // Meets another shell
+            const char entered = gameboard_[to];
+            if (previous == NONE && entered != ' ' && entered != '@') { return false; } // Hits something
         }
     }
+
+    // Vacate the old cells
+    for (int slot = 0; slot < count; ++slot) {
+        const int from = shellFrom_[slot];
+        toggleShellHash(slot);
+        shellGrid_.clear(from);
+        setCell(neighbors_->xOf(from), neighbors_->yOf(from), shells_.isAboveMine(slot) ? '@' : ' ');
+    }
+
+    // Land the shells, then store them in (x, y) order
+    shellSurvivors_.clear();
+    for (int slot = 0; slot < count; ++slot) {
+        const int to = shellTo_[slot];
+        const int x = neighbors_->xOf(to);
+        const int y = neighbors_->yOf(to);
+        shells_.setLocation(slot, x, y);
+        shells_.setAboveMine(slot, gameboard_[to] == '@');
+        setCell(x, y, '*');
+        shellSurvivors_.push_back(slot);
+    }
+    compactShellsInCellOrder();
+    for (int slot = 0; slot < count; ++slot) { toggleShellHash(slot); }
+    return true;
+}
+
+/**
+ * @brief Plays one shell half step (moveShells() then checkShellsCollide()) on the bit planes.
+ *
+ * Succeeds only if @c shellBitboard_ proves that no shell interacts with another in this half
+ * step - the sequential rules then give every shell the same outcome whatever the order. The
+ * outcomes are written back to the board, the tanks and @c shells_: vacated cells get their
+ * mine back or are cleared, walls are weakened or destroyed, hit tanks are killed, and the
+ * surviving shells are stored in (x, y) order, as checkShellsCollide() would leave them.
+ *
+ * @return false, with nothing changed, if the half step must use the sequential rules.
+ */
+bool GM_209277367_322542887::advanceShellsWithBitboard() {
+    if (!useShellBitboard_ || shells_.liveCount() < shellBitboardMinShells_ || !shellBitboard_.advance(shells_)) {
+        return false;
+    }
+
+    bool tanks_found = true; // A tank symbol without a tank is left to the sequential rules
+    shellBitboard_.forEachTankHit([&](const int x, const int y) { tanks_found &= getTankIndexAt(x, y) != -1; });
+    if (!tanks_found) { return false; }
+
+    // Vacate the old cells
+    for (int slot = shells_.nextAlive(0); slot < shells_.slots(); slot = shells_.nextAlive(slot + 1)) {
+        const int x = shells_.getX(slot);
+        const int y = shells_.getY(slot);
+        toggleShellHash(slot);
+        shellGrid_.clear(gameboard_.index(x, y));
+        setCell(x, y, shells_.isAboveMine(slot) ? '@' : ' ');
+    }
+    shells_.clear();
+
+    // Apply what the shells hit, then place the survivors
+    shellBitboard_.forEachWallHit([this](const int x, const int y) { setCell(x, y, '$'); });
+    shellBitboard_.forEachWeakWallHit([this](const int x, const int y) { setCell(x, y, ' '); });
+    shellBitboard_.forEachTankHit([this](const int x, const int y) {
+        killTank(getTankIndexAt(x, y));
+        setCell(x, y, ' ');
+    });
+    shellBitboard_.forEachLandedShell([this](const int x, const int y, const Direction dir, const bool above_mine) {
+        const int slot = spawnShell(x, y, dir);
+        if (above_mine) { setShellAboveMine(slot, true); }
+        setCell(x, y, '*');
+    });
+    return true;
 }
 
 /**
@@ -784,28 +1446,53 @@ bool GM_209277367_322542887::initiateGame(const SatelliteView& gameBoard) {
     tanks_.clear();
 
     int tank_1_count = 0, tank_2_count = 0;
-    gameboard_.assign(height_, std::vector<char>(width_, ' '));
+    gameboard_.assign(width_, height_, ' ');
+    spareBoard_.assign(width_, height_, ' '); // Allocates only if the last result took the previous spare
+    neighbors_ = NeighborTable::forBoard(width_, height_);
+    shellGrid_.assign(gameboard_.size());
+    shellCountStampAt_.assign(gameboard_.size(), 0);
+    shellCount_.assign(gameboard_.size(), 0);
+    shellCountStamp_ = 0;
+    tankGrid_.assign(gameboard_.size());
 
     for (int i = 0; i < height_; ++i) {
         for (int j = 0; j < width_; ++j) {
             char cell = gameBoard.getObjectAt(static_cast<size_t>(j), static_cast<size_t>(i));
-            gameboard_[i][j] = cell; // copy snapshot into our board
+            gameboard_.at(j, i) = cell; // copy snapshot into our board
 
             if (cell == '1' || cell == '2') {
                 int player = cell - '0';
                 int& tankCount = (player == 1) ? tank_1_count : tank_2_count;
                 auto& factory = (player == 1) ? player1TankFactory_ : player2TankFactory_;
 
-                auto tank = factory(player, tankCount);
-                auto tankInfo = std::make_unique<TankInfo>(
-                    tankCount, std::make_pair(j, i), numShells_, player, std::move(tank)
-                );
-                tanks_.push_back(std::move(tankInfo));
+                const int tank_index = tanks_.add(tankCount, j, i, numShells_, player, factory(player, tankCount));
+                tankGrid_.add(gameboard_.index(j, i), tank_index);
                 ++tankCount;
             }
         }
     }
 
+    resetSnapshot(); // Start-of-game snapshot for battle info requests
+    resetBattleInfoDeltas();
+    useShellBitboard_ = shellBitboardEnabled_ && ShellBitboard::fits(width_, height_);
+    if (useShellBitboard_) { shellBitboard_.assign(gameboard_); }
+
+    // Start the incremental tank counters
+    aliveTanks_ = {static_cast<size_t>(tank_1_count), static_cast<size_t>(tank_2_count)};
+    outOfAmmoTanks_ = (numShells_ <= 0) ? aliveTanks_ : array<size_t, 2>{0, 0};
+
+    // Reserve the shell pool - at most every tank's ammo, and shells never outnumber the cells for long
+    const size_t tank_count = tanks_.size();
+    const size_t shell_capacity = std::min(tank_count * numShells_, gameboard_.size() + tank_count);
+    tankActions_.assign(tank_count, {ActionRequest::DoNothing, false}); // Indexed by tank, written for the alive ones
+    actionCpuNs_.assign(tank_count, 0);
+    actionTimedOut_.assign(tank_count, false);
+    shells_.reset(shell_capacity);
+    shellSurvivors_.clear();
+    shellSurvivors_.reserve(shell_capacity);
+    for (auto* path : {&shellFrom_, &shellVia_, &shellTo_}) { path->reserve(shell_capacity); }
+    stateHash_.set(computeStateHash()); // Kept up to date incrementally from now on
+
     // If a side has zero tanks, mark the game as over and log.
     if (tank_1_count == 0 || tank_2_count == 0) {
         if (verbose_) {
@@ -818,7 +1505,7 @@ bool GM_209277367_322542887::initiateGame(const SatelliteView& gameBoard) {
             }
         }
         gameOver_ = true;
-        if (verbose_) { gameLog_.flush(); gameLog_.close(); }
+        closeVerboseLog();
     }
 
     return true;
@@ -833,7 +1520,7 @@ bool GM_209277367_322542887::initiateGame(const SatelliteView& gameBoard) {
  * prolonged zero-ammo state).
  *
  * Per turn:
- * - Snapshots @c gameboard_ to @c lastRoundGameboard_.
+ * - Start-of-turn board is snapshotted lazily, only if a tank requests battle info.
  * - Collects actions (getTankActions) and executes them (performTankActions).
  * - Advances shells and resolves collisions (moveShells, checkShellsCollide).
  * - Logs the state (updateGameLog) and updates win/termination flags
@@ -858,89 +1545,346 @@ GameResult GM_209277367_322542887::run(size_t map_width, size_t map_height, cons
         size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
         TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) {
 
-    (void)name1, (void)name2;
+    startGame(map_width, map_height, map, std::move(map_name), max_steps, num_shells, player1, std::move(name1),
+        player2, std::move(name2), std::move(player1_tank_algo_factory), std::move(player2_tank_algo_factory));
+
+    // std::cout << "\nGame Started!" << endl;
+
+    // Main game loop, specialized so the silent loop carries no logging code
+    if (verbose_) { while (playTurn<true>()) {} }
+    else { while (playTurn<false>()) {} }
+
+    return finishGame();
+}
+
+/**
+ * @brief Sets up a game without playing any turn.
+ *
+ * Resets the GameManager, stores the parameters, opens the verbose log and starts the replay
+ * recording when enabled, and builds the board and tanks from @p map. The game is then advanced
+ * one turn at a time with playTurn() and closed with finishGame(); run() does exactly that.
+ *
+ * Parameters are the same as for run().
+ */
+void GM_209277367_322542887::startGame(size_t map_width, size_t map_height, const SatelliteView& map, string map_name,
+        size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
+        TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) {
+
+    reset(); // In case the previous game was not reset
+    extGameResult_.budgeted = actionBudgetNs_ > 0 || gameBudgetNs_ > 0 || actionTimeoutNs_ > 0;
+    if (actionTimeoutNs_ > 0 && !watchdog_) { watchdog_ = make_unique<ActionWatchdog>(); }
+    phaseTimer_.start(extGameResult_);
+
     width_ = map_width, height_ = map_height, maxSteps_ = max_steps, numShells_ = num_shells, player1_ = &player1, player2_ = &player2;
-    player1TankFactory_ = player1_tank_algo_factory;
-    player2TankFactory_ = player2_tank_algo_factory;
+    player1TankFactory_ = std::move(player1_tank_algo_factory);
+    player2TankFactory_ = std::move(player2_tank_algo_factory);
 
-    string logName = "output_" + map_name + "_GM_209277367_322542887_" + name1 + "_" + name2;
     if (verbose_) {
-        gameLog_.open(logName, std::ios::out | std::ios::trunc);
-        if (!gameLog_.is_open()) std::cerr << "Failed to open log file: " << logName << endl;
+        const string logName = "output_" + map_name + "_GM_209277367_322542887_" + name1 + "_" + name2;
+        gameLogFile_.open(logName, std::ios::out | std::ios::trunc);
+        if (!gameLogFile_.is_open()) std::cerr << "Failed to open log file: " << logName << endl;
     }
-    
+
+
+    if (callbackThreads_ <= 1) { callbackPool_.reset(); }
+    else if (!callbackPool_ || callbackPool_->size() != callbackThreads_) { callbackPool_ = make_unique<TaskPool>(callbackThreads_); }
 
     initiateGame(map); // Copy game board and initiate tanks
+    resetCycleDetection();
 
-    // std::cout << "\nGame Started!" << endl;
+    replayPath_ = replayFile_;
+    if (replayPath_.empty() && !replayDir_.empty()) {
+        replayPath_ = (fs::path(replayDir_) / ("replay_" + map_name + "_" + name1 + "_" + name2 + ".tkr")).string();
+    }
+    if (!replayPath_.empty()) {
+        replay_.begin(gameboard_, maxSteps_, numShells_, tanks_.size(), map_name, name1, name2);
+    }
+}
 
-    // Game loop
-    while (!gameOver_) { // Main game loop
-        // Set the gameboard to the last round's gameboard
-        lastRoundGameboard_ = gameboard_;
-
-        // Check if the maximum number of turns has been reached
-        if (turn_ >= maxSteps_) {
-            gameOver_ = true; // Set the game over flag
-            if (verbose_) gameLog_ << "Tie, reached max steps = " << maxSteps_ << ", player 1 has " << numTanks1_ << " tanks, player 2 has "
-               << numTanks2_ << " tanks" << endl;
-            break; // Exit the loop
-        }
-        // std::cout << "\nTurn: " << turn_ << endl; // Print the current turn number
+/**
+ * @brief Plays a single turn of a game set up by startGame().
+ *
+ * Ends the game if the maximum number of turns has been reached; otherwise collects and
+ * performs the tank actions, advances the shells twice, logs the turn and checks the
+ * termination conditions, finalizing @c gameResult_ when the game ends. In builds with
+ * profiling, each part is timed into its @c extGameResult_ phase.
+ *
+ * @return true if the game continues, false once it is over.
+ */
+bool GM_209277367_322542887::playTurn() { return verbose_ ? playTurn<true>() : playTurn<false>(); }
 
+/**
+ * @brief playTurn() for a verbose (@p Verbose true) or silent game.
+ *
+ * The silent instantiation contains no logging code at all; run() calls it directly.
+ */
+template <bool Verbose>
+bool GM_209277367_322542887::playTurn() {
+    if (gameOver_) { return false; }
+    PhaseScope status_phase(phaseTimer_, ExtGameResult::STATUS); // Termination checks; the scopes below time the rest
+
+    // Check if the maximum number of turns has been reached
+    if (turn_ >= maxSteps_) {
+        gameOver_ = true; // Set the game over flag
+        if constexpr (Verbose) gameLog_ << "Tie, reached max steps = " << maxSteps_ << ", player 1 has " << numTanks1_ << " tanks, player 2 has "
+           << numTanks2_ << " tanks" << '\n';
+        return false;
+    }
+    // std::cout << "\nTurn: " << turn_ << endl; // Print the current turn number
+
+    {
+        PhaseScope phase(phaseTimer_, ExtGameResult::GET_ACTIONS);
         getTankActions(); // Get actions for both tanks and update battle_info_requested
+    }
+    {
+        PhaseScope phase(phaseTimer_, ExtGameResult::TANK_ACTIONS);
         performTankActions(); // Perform actions for both tanks
+    }
+    if (!replayPath_.empty()) {
+        PhaseScope phase(phaseTimer_, ExtGameResult::LOGGING);
+        recordReplayTurn();
+    }
 
-        for (size_t i = 0; i < 2; ++i) { // Iterate through each tank
-            moveShells(shells_); // Move the shells
-            checkShellsCollide(); // Check for shell collisions
-        }
+    {
+        PhaseScope phase(phaseTimer_, ExtGameResult::SHELLS);
+        advanceShells(); // Two half steps
+    }
 
-        updateGameLog();
+    {
+        PhaseScope phase(phaseTimer_, ExtGameResult::LOGGING);
+        updateGameLog<Verbose>();
+    }
 
-        // std::cout << "\nGame Board after turn " << turn_ << ":" << endl; // Print the game board after each turn
-        // printBoard(); // Print the game board
+    // std::cout << "\nGame Board after turn " << turn_ << ":" << endl; // Print the game board after each turn
+    // printBoard(); // Print the game board
 
-        checkTanksStatus(); // Check if tanks are out of ammo and check for tanks alive
+    checkTanksStatus(); // Check if tanks are out of ammo and check for tanks alive
 
-        if (noAmmoFlag_) { // If both tanks are out of ammo
-            noAmmoTimer_--; // Decrease the no ammo timer
-            if (noAmmoTimer_ == 0) { // Check if the timer has reached zero
-                updateGameResult(0, 2, {numTanks1_, numTanks2_}, gameboard_, turn_);
-                gameOver_ = true; // Set game_over to true if both tanks are out of ammo for 40 turns
-            if (verbose_) gameLog_ << "Tie, both players have zero shells for " << 40 << " steps" << endl; // Print message if both tanks are out of ammo
-            }
+    if (noAmmoFlag_) { // If both tanks are out of ammo
+        noAmmoTimer_--; // Decrease the no ammo timer
+        if (noAmmoTimer_ == 0) { // Check if the timer has reached zero
+            updateGameResult(0, 2, {numTanks1_, numTanks2_}, turn_);
+            gameOver_ = true; // Set game_over to true if both tanks are out of ammo for 40 turns
+            if constexpr (Verbose) gameLog_ << "Tie, both players have zero shells for " << 40 << " steps" << '\n'; // Print message if both tanks are out of ammo
         }
+    }
 
-        if (gameOver_) { // Check if the game is over
-            if (gameOverStatus_ == 3) { // Both players are missing tanks
-                updateGameResult(0, 0, {0, 0}, gameboard_, turn_);
-                if (verbose_) gameLog_ << "Tie, both players have zero tanks" <<  endl;
-            } else if (gameOverStatus_ == 1) { // Player 1 has no tanks left
-                updateGameResult(2, 0, {0, numTanks2_}, gameboard_ ,turn_);
-                if (verbose_) gameLog_ << "Player 2 won with " << numTanks2_ << " tanks still alive" << endl;
-            } else if (gameOverStatus_ == 2) { // Player 2 has no tanks left
-                updateGameResult(1, 0, {numTanks1_, 0}, gameboard_ , turn_);
-                if (verbose_) gameLog_ << "Player 1 won with " <<  numTanks1_ << " tanks still alive" << endl;
-            }
+    if (extGameResult_.budgeted && !gameOver_ && (extGameResult_.forfeited[0] || extGameResult_.forfeited[1])) {
+        gameOverStatus_ = 5; // Over a time budget, see setActionBudget
+        gameOver_ = true;
+    }
 
-            break; // Exit the game loop if the game is over
+    if (cycleWindow_ > 0 && !gameOver_) { detectCycle(); }
+
+    if (gameOver_) { // Check if the game is over
+        if (gameOverStatus_ == 3) { // Both players are missing tanks
+            updateGameResult(0, 0, {0, 0}, turn_);
+            if constexpr (Verbose) gameLog_ << "Tie, both players have zero tanks" << '\n';
+        } else if (gameOverStatus_ == 1) { // Player 1 has no tanks left
+            updateGameResult(2, 0, {0, numTanks2_}, turn_);
+            if constexpr (Verbose) gameLog_ << "Player 2 won with " << numTanks2_ << " tanks still alive" << '\n';
+        } else if (gameOverStatus_ == 2) { // Player 2 has no tanks left
+            updateGameResult(1, 0, {numTanks1_, 0}, turn_);
+            if constexpr (Verbose) gameLog_ << "Player 1 won with " <<  numTanks1_ << " tanks still alive" << '\n';
+        } else if (gameOverStatus_ == 4) { // The game repeats a cycle, see setCycleWindow
+            updateGameResult(0, 1, {numTanks1_, numTanks2_}, turn_);
+            if constexpr (Verbose) gameLog_ << "Tie, the game repeats every " << cyclePeriod_ << " steps, player 1 has " << numTanks1_
+                << " tanks, player 2 has " << numTanks2_ << " tanks" << '\n';
+        } else if (gameOverStatus_ == 5) { // A player forfeited, see setActionBudget
+            const array<bool, 2>& forfeited = extGameResult_.forfeited;
+            const int winner = forfeited[0] == forfeited[1] ? 0 : (forfeited[0] ? 2 : 1);
+            updateGameResult(winner, 0, {forfeited[0] ? 0 : numTanks1_, forfeited[1] ? 0 : numTanks2_}, turn_);
+            if constexpr (Verbose) {
+                if (winner == 0) gameLog_ << "Tie, both players forfeited (over their time budgets)" << '\n';
+                else gameLog_ << "Player " << winner << " won, player " << 3 - winner << " forfeited (over its time budget)" << '\n';
+            }
         }
 
-        ++turn_; // Increment the turn counter
+        return false; // The game is over
     }
 
-   closeVerboseLog(); // Close the verbose log if it was opened
+    ++turn_; // Increment the turn counter
+    return true;
+}
 
+/**
+ * @brief Closes a game played with startGame() / playTurn().
+ *
+ * Hands the verbose log and the replay, if any, to the background writer. If the game set a
+ * result, the final board is moved into its @c gameState without a copy, and the spare board
+ * sized by initiateGame() takes its place, so @c gameboard_ keeps its storage (blank until
+ * the next game or restoreState()).
+ *
+ * @return Final @c GameResult moved out of @c gameResult_.
+ */
+GameResult GM_209277367_322542887::finishGame() {
+    closeVerboseLog(); // Close the verbose log if it was opened
+    if (!replayPath_.empty()) { writeReplay(replayPath_); }
+
+    if (resultReady_) {
+        std::swap(gameboard_, spareBoard_);
+        gameResult_.gameState = make_unique<ExtSatelliteView>(std::move(spareBoard_));
+    }
+    resultReady_ = false;
     return std::move(gameResult_);
 }
 
+/**
+ * @brief Returns the GameManager to the state of a new instance, ready for another game.
+ *
+ * Destroys the tank algorithms and drops the tank factories and players of the last game, so
+ * their libraries may be unloaded right after. Resets the turn counter, the termination flags
+ * and timers, the result and the logs. The board, grids, shell pool and snapshot keep their
+ * storage, and the settings (replay, callback threads, cycle window, shell backend, budgets)
+ * are kept. startGame() calls it too, so run() is safe on a GameManager that was not reset.
+ */
+void GM_209277367_322542887::reset() {
+    tanks_.clear();
+    player1TankFactory_ = nullptr;
+    player2TankFactory_ = nullptr;
+    player1_ = nullptr;
+    player2_ = nullptr;
+
+    aliveTanks_ = {};
+    outOfAmmoTanks_ = {};
+    shells_.clear();
+    tankActions_.clear();
+    actionCpuNs_.clear();
+    actionTimedOut_.clear();
+    battleInfoRequests_.clear();
+    stateHash_.clear();
+    resetCycleDetection();
+
+    turn_ = 0;
+    gameOver_ = false;
+    noAmmoFlag_ = false;
+    gameOverStatus_ = 0;
+    noAmmoTimer_ = 0;
+    numTanks1_ = 0;
+    numTanks2_ = 0;
+    gameResult_ = {};
+    resultReady_ = false;
+    extGameResult_ = {};
+
+    if (gameLogFile_.is_open()) { gameLogFile_.close(); } // Game abandoned before finishGame()
+    gameLog_.str("");
+    gameLog_.clear();
+    replayPath_.clear();
+}
+
+/**
+ * @brief Saves the state of the game between two turns.
+ *
+ * Copies the board, the tanks, the shells and every counter the turn loop uses into
+ * @p state. Assigning into a @p state that was used before reuses its storage, so saving
+ * is a plain memory copy. The verbose log, the replay recording, the players and the tank
+ * algorithms are not part of the state.
+ *
+ * @param state Destination of the saved state.
+ */
+void GM_209277367_322542887::saveState(GameState& state) const {
+    state.board = gameboard_;
+    state.tanks = tanks_.getState();
+    state.aliveTanks = aliveTanks_;
+    state.outOfAmmoTanks = outOfAmmoTanks_;
+    state.shells = shells_;
+    state.shellGrid = shellGrid_;
+    state.tankGrid = tankGrid_;
+    state.turn = turn_;
+    state.gameOver = gameOver_;
+    state.noAmmoFlag = noAmmoFlag_;
+    state.gameOverStatus = gameOverStatus_;
+    state.noAmmoTimer = noAmmoTimer_;
+    state.numTanks1 = numTanks1_;
+    state.numTanks2 = numTanks2_;
+    state.hash = stateHash_.value();
+
+    state.hasResult = resultReady_;
+    if (state.hasResult) {
+        state.winner = gameResult_.winner;
+        state.reason = gameResult_.reason;
+        state.remainingTanks = gameResult_.remaining_tanks;
+        state.rounds = gameResult_.rounds;
+    }
+}
+
+/**
+ * @brief Continues the game from a state saved by saveState().
+ *
+ * The state must come from the game currently set up by startGame() (the same map), as
+ * the tanks keep their algorithms. The start-of-turn snapshot is rebuilt from the restored
+ * board. Restoring does not rewind the verbose log or the replay recording.
+ *
+ * @param state State saved earlier in this game.
+ * @return false, leaving the game unchanged, if the state belongs to a different board or tank set,
+ *         or a getAction() call of this game was abandoned (see setActionBudget).
+ */
+bool GM_209277367_322542887::restoreState(const GameState& state) {
+    if (state.board.getWidth() != width_ || state.board.getHeight() != height_ || state.tanks.x.size() != static_cast<size_t>(tanks_.size())) {
+        std::cerr << "Game state does not match the current game" << endl;
+        return false;
+    }
+    if (extGameResult_.timedOutCalls[0] + extGameResult_.timedOutCalls[1] > 0) { // A tank lost its algorithm
+        std::cerr << "Game state cannot be restored after an abandoned getAction() call" << endl;
+        return false;
+    }
+
+    gameboard_ = state.board;
+    tanks_.setState(state.tanks);
+    aliveTanks_ = state.aliveTanks;
+    outOfAmmoTanks_ = state.outOfAmmoTanks;
+    shells_ = state.shells;
+    shellGrid_ = state.shellGrid;
+    tankGrid_ = state.tankGrid;
+    turn_ = state.turn;
+    gameOver_ = state.gameOver;
+    noAmmoFlag_ = state.noAmmoFlag;
+    gameOverStatus_ = state.gameOverStatus;
+    noAmmoTimer_ = state.noAmmoTimer;
+    numTanks1_ = state.numTanks1;
+    numTanks2_ = state.numTanks2;
+    stateHash_.set(state.hash);
+
+    if (state.hasResult) { updateGameResult(state.winner, state.reason, state.remainingTanks, state.rounds); }
+    else { resultReady_ = false; }
+
+    resetSnapshot(); // The start-of-turn snapshot is the restored board
+    resetBattleInfoDeltas(); // The players' views are unrelated to the restored board
+    resetCycleDetection(); // The turns seen may not lead to the restored state
+    if (useShellBitboard_) { shellBitboard_.assign(gameboard_); }
+    return true;
+}
+
+/**
+ * @brief Computes the Zobrist hash of the current state from scratch.
+ *
+ * Combines the key of every board cell, every alive tank (index, location, direction) and
+ * every live shell (location, direction, above-mine flag). @c stateHash_ is seeded with it
+ * when the game starts and then updated on each change, so getStateHash() always equals
+ * this value; calling it mid-game is only useful to validate that.
+ *
+ * @return Hash of the current state.
+ */
+uint64_t GM_209277367_322542887::computeStateHash() const {
+    ZobristHash hash;
+    for (size_t idx = 0; idx < gameboard_.size(); ++idx) { hash.toggleCell(idx, gameboard_[idx]); }
+    for (const int i : tanks_.live()) {
+        if (tanks_.isDestroyed(i)) { continue; } // Killed this turn
+        const auto [x, y] = tanks_.getLocation(i);
+        hash.toggleTank(i, gameboard_.index(x, y), tanks_.getDirection(i));
+    }
+    for (int slot = shells_.nextAlive(0); slot < shells_.slots(); slot = shells_.nextAlive(slot + 1)) {
+        hash.toggleShell(gameboard_.index(shells_.getX(slot), shells_.getY(slot)),
+            shells_.getDirection(slot), shells_.isAboveMine(slot));
+    }
+    return hash.value();
+}
+
 /**
  * @brief Calculates the next board coordinates from a starting point and direction.
  *
- * Uses the @c directionMap to translate a @p dir into (dx, dy) offsets.
- * If @p backwards is true, reverses the direction. Wraps around the board
- * edges using modulo width/height to ensure valid coordinates.
+ * Looks the step up in the shared @c neighbors_ table, which already wraps around
+ * the board edges. If @p backwards is true, reverses the direction.
  *
  * @param x         Current x-coordinate.
  * @param y         Current y-coordinate.
@@ -949,39 +1893,138 @@ GameResult GM_209277367_322542887::run(size_t map_width, size_t map_height, cons
  * @return Pair of (new_x, new_y) coordinates.
  */
 pair<int, int> GM_209277367_322542887::nextLocation(const int x, const int y, const Direction dir, const bool backwards) const {
-    auto [dx, dy] = directionMap.at(dir);
-    if (backwards) { // If the direction is backwards, reverse the direction
-        dx = -dx;
-        dy = -dy;
+    return neighbors_->next(x, y, backwards ? oppositeDirection(dir) : dir);
+}
+
+/**
+ * @brief Writes a symbol into a board cell and records the change for the lazy snapshot.
+ *
+ * Swaps the cell's key in @c stateHash_ and marks the cell's row as dirty (it may now differ from @c lastRoundGameboard_). While the
+ * action phase of a turn is running and the turn's snapshot has not been taken yet, the
+ * overwritten symbol is also journaled so the snapshot can be rolled back to the start of
+ * the turn if a later tank requests battle info.
+ *
+ * @param x X-coordinate of the cell.
+ * @param y Y-coordinate of the cell.
+ * @param symbol New board symbol.
+ */
+void GM_209277367_322542887::setCell(const int x, const int y, const char symbol) {
+    const size_t idx = gameboard_.index(x, y);
+
+    if (!dirtyRows_[y]) { // First change to this row since the last snapshot sync
+        dirtyRows_[y] = true;
+        dirtyRowList_.push_back(y);
+    }
+
+    if (journalWrites_ && snapshotTurn_ != turn_) { // Snapshot of this turn may still be requested
+        turnJournal_.emplace_back(idx, gameboard_[idx]);
     }
-    return {(x + dx + width_) % width_, (y + dy + height_) % height_}; // Calculate the next location
+
+    stateHash_.toggleCell(idx, gameboard_[idx]);
+    stateHash_.toggleCell(idx, symbol);
+    if (useShellBitboard_) { shellBitboard_.update(x, y, gameboard_[idx], symbol); }
+    gameboard_[idx] = symbol;
+}
+
+/**
+ * @brief Makes @c lastRoundGameboard_ an exact copy of the current board.
+ *
+ * Called once after the board is initialized; from then on the snapshot is only
+ * brought up to date lazily by syncLastRoundGameboard().
+ */
+void GM_209277367_322542887::resetSnapshot() {
+    lastRoundGameboard_ = gameboard_;
+    dirtyRows_.assign(height_, false);
+    dirtyRowList_.clear();
+    turnJournal_.clear();
+    journalWrites_ = false;
+    snapshotTurn_ = -1;
+}
+
+/**
+ * @brief Makes the next battle info of each player a full view.
+ */
+void GM_209277367_322542887::resetBattleInfoDeltas() {
+    for (auto& delta : battleInfoDeltas_) { delta.reset(gameboard_.size()); }
+}
+
+/**
+ * @brief Brings @c lastRoundGameboard_ to the board state at the start of the current turn.
+ *
+ * Does nothing if the snapshot was already taken this turn. Otherwise copies only the rows
+ * changed since the previous sync, then undoes the cell writes made earlier in this turn's
+ * action phase (in reverse order) so the snapshot reflects the start of the turn. Rows touched
+ * by the rollback differ from @c gameboard_ again and are re-marked dirty.
+ *
+ * @return The start-of-turn snapshot.
+ */
+Gameboard& GM_209277367_322542887::syncLastRoundGameboard() {
+    if (snapshotTurn_ == turn_) { return lastRoundGameboard_; } // Already synced this turn
+
+    // Copy the changed rows, listing the changed cells for the players' battle info deltas
+    const bool track_deltas = battleInfoDeltas_[0].primed() || battleInfoDeltas_[1].primed();
+    for (const int y : dirtyRowList_) {
+        const char* row = gameboard_.row(y);
+        char* snapshot_row = &lastRoundGameboard_.at(0, y);
+        if (track_deltas) {
+            for (int x = 0; x < width_; ++x) {
+                if (snapshot_row[x] != row[x]) {
+                    battleInfoDeltas_[0].add(gameboard_.index(x, y));
+                    battleInfoDeltas_[1].add(gameboard_.index(x, y));
+                }
+            }
+        }
+        std::copy(row, row + width_, snapshot_row);
+        dirtyRows_[y] = false;
+    }
+    dirtyRowList_.clear();
+
+    // Roll back this turn's writes, oldest value wins
+    for (auto it = turnJournal_.rbegin(); it != turnJournal_.rend(); ++it) {
+        const auto [idx, old_symbol] = *it;
+        lastRoundGameboard_[idx] = old_symbol;
+        if (track_deltas) { // May differ from the previous snapshot even if the current board does not
+            battleInfoDeltas_[0].add(idx);
+            battleInfoDeltas_[1].add(idx);
+        }
+
+        if (const int y = static_cast<int>(idx / width_); !dirtyRows_[y]) {
+            dirtyRows_[y] = true;
+            dirtyRowList_.push_back(y);
+        }
+    }
+    turnJournal_.clear();
+
+    snapshotTurn_ = turn_;
+    return lastRoundGameboard_;
 }
 
 /**
  * @brief Updates the stored final game result.
  *
- * Sets the winner, reason, remaining tanks per player, final game state,
- * and total number of rounds in @c gameResult_.
+ * Sets the winner, reason, remaining tanks per player and total number of
+ * rounds in @c gameResult_. The final game state is @c gameboard_, which
+ * finishGame() moves into the result.
  *
  * @param winner          ID of the winning player (0 for tie).
  * @param reason          Integer castable to @c GameResult::Reason.
  * @param remaining_tanks Vector of remaining tanks per player.
- * @param game_state      Final game board state as a SatelliteView.
  * @param rounds          Total rounds played.
  */
-void GM_209277367_322542887::updateGameResult(int winner, int reason, vector<size_t> remaining_tanks,
-    vector<vector<char>>& game_state, size_t rounds) {
+void GM_209277367_322542887::updateGameResult(int winner, int reason, vector<size_t> remaining_tanks, size_t rounds) {
     gameResult_.winner = winner;
     gameResult_.reason = static_cast<GameResult::Reason>(reason);
-    gameResult_.remaining_tanks = remaining_tanks;
-    gameResult_.gameState = make_unique<ExtSatelliteView>(width_, height_, game_state);
+    gameResult_.remaining_tanks = std::move(remaining_tanks);
     gameResult_.rounds = rounds;
+    resultReady_ = true;
 }
 
 // Function to print gameboard
 void GM_209277367_322542887::printBoard() const {
-    for (const auto& row : gameboard_) {
-        for (const auto& cell : row) {
+    for (int y = 0; y < height_; ++y) {
+        const char* row = gameboard_.row(y);
+        for (int x = 0; x < width_; ++x) {
+            const char cell = row[x];
             switch (cell) {
                 case '1': // Tank 1 - Bright Blue
                     std::cout << "\033[94m" << cell << "\033[0m";
@@ -1054,34 +2097,48 @@ pair<int, int> GM_209277367_322542887::getGameboardSize() const {
  * - If just killed this turn, logs action with "(killed)" and increments its dead-turn counter.
  * - If already dead, logs "killed".
  *
- * Entries are separated by spaces and commas, one turn per log line.
- * Logging occurs only if @c verbose_ is true.
+ * Entries are separated by spaces and commas, one turn per log line. The tanks killed
+ * this turn are then retired from the live list. The silent instantiation
+ * (@p Verbose false) only does the retiring, which visits the live tanks only.
  */
+template <bool Verbose>
 void GM_209277367_322542887::updateGameLog() {
-    for (int i = 0; i < static_cast<int>(tanks_.size()); ++i) {
-        if (i != 0) { if (verbose_) gameLog_ << " "; }
+    if constexpr (Verbose) { // The log has an entry for every tank
+        for (int i = 0; i < tanks_.size(); ++i) {
+            if (i != 0) { gameLog_ << " "; }
+
+            int tank_state = tanks_.getIsAlive(i);
+            if (tank_state == 0) {
+                gameLog_ << getEnumName(tankActions_[i].first);
+                if (!tankActions_[i].second) { gameLog_ << " (ignored)"; }
+            }
+            else if (tank_state == 1) {
+                if (!tankActions_[i].second) { gameLog_ << " (ignored)"; }
+                gameLog_ << getEnumName(tankActions_[i].first) << " (killed)";
+                tanks_.increaseTurnsDead(i);
+            }
+            else { gameLog_ << "killed"; }
 
-        int tank_state = tanks_[i]->getIsAlive();
-        if (tank_state == 0) {
-            if (verbose_) gameLog_ << getEnumName(tankActions_[i].first);
-            if (!tankActions_[i].second) { if (verbose_) gameLog_ << " (ignored)"; }
-        }
-        else if (tank_state == 1) {
-            if (!tankActions_[i].second) { if (verbose_) gameLog_ << " (ignored)"; }
-            if (verbose_) gameLog_ << getEnumName(tankActions_[i].first) << " (killed)";
-            tanks_[i]->increaseTurnsDead();
+            if (i != tanks_.size() - 1) { gameLog_ << ","; }
         }
-        else {if (verbose_) gameLog_ << "killed"; }
 
-        if (i != static_cast<int>(tanks_.size()) - 1) { if (verbose_) gameLog_ << ","; }
+        gameLog_ << '\n';
     }
 
-    if (verbose_) gameLog_ << endl;
+    tanks_.retireKilled(); // Drop the tanks killed this turn from the live list
 }
 
+/**
+ * @brief Hands the buffered verbose log over to the background writer.
+ *
+ * The log is built in @c gameLog_ during the game; the writer copies it to
+ * @c gameLogFile_ and closes the file. Does nothing if the log file is not open
+ * (not verbose, failed to open, or already handed over).
+ */
 void GM_209277367_322542887::closeVerboseLog() {
-    if (verbose_ && gameLog_.is_open()) {
-        gameLog_.flush();
-        gameLog_.close();
+    if (verbose_ && gameLogFile_.is_open()) {
+        GameLogWriter::get().submit(std::move(gameLogFile_), std::move(gameLog_).str());
+        gameLog_.str("");
+        submittedLogs_ = true;
     }
 }
@@ -0,0 +1,72 @@
+#include "GameLogWriter.h"
+
+#include <utility>
+#include <vector>
+
+namespace GameManager_209277367_322542887 {
+
+// Constructor - starts the worker thread
+GameLogWriter::GameLogWriter() : worker_(&GameLogWriter::workerLoop, this) {}
+
+// Destructor - drains the queue and joins the worker
+GameLogWriter::~GameLogWriter() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    jobsReady_.notify_one();
+    worker_.join();
+}
+
+GameLogWriter& GameLogWriter::get() {
+    static GameLogWriter instance;
+    return instance;
+}
+
+// Hand a finished log over to the worker, waiting first if too much is already pending
+void GameLogWriter::submit(ofstream file, string contents) {
+    std::unique_lock lock(mutex_);
+    jobsDone_.wait(lock, [this] { return pendingBytes_ < MAX_PENDING_BYTES; });
+
+    pendingBytes_ += contents.size();
+    jobs_.push_back({std::move(file), std::move(contents)});
+    lock.unlock();
+    jobsReady_.notify_one();
+}
+
+void GameLogWriter::flush() {
+    std::unique_lock lock(mutex_);
+    jobsDone_.wait(lock, [this] { return jobs_.empty() && pendingBytes_ == 0; });
+}
+
+// Take every queued job at once and write the batch outside the lock
+void GameLogWriter::workerLoop() {
+    std::vector<Job> batch;
+
+    while (true) {
+        std::unique_lock lock(mutex_);
+        jobsReady_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        if (jobs_.empty()) { return; } // Stopping and nothing left to write
+
+        batch.clear();
+        while (!jobs_.empty()) {
+            batch.push_back(std::move(jobs_.front()));
+            jobs_.pop_front();
+        }
+        lock.unlock();
+
+        size_t written = 0;
+        for (auto& [file, contents] : batch) {
+            file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            file.close();
+            written += contents.size();
+        }
+
+        lock.lock();
+        pendingBytes_ -= written;
+        lock.unlock();
+        jobsDone_.notify_all();
+    }
+}
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,203 @@
+#include "ReplayEngine.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace GameManager_209277367_322542887 {
+
+namespace {
+    // Returns the recorded actions of one tank, then DoNothing
+    class ScriptedTankAlgorithm final : public TankAlgorithm {
+        const vector<ActionRequest>* script_;
+        size_t* next_; // Owned by the engine, so checkpoints can rewind it
+
+        public:
+            ScriptedTankAlgorithm(const vector<ActionRequest>& script, size_t& next) : script_(&script), next_(&next) {}
+
+            ActionRequest getAction() override {
+                return (*next_ < script_->size()) ? (*script_)[(*next_)++] : ActionRequest::DoNothing;
+            }
+            void updateBattleInfo(BattleInfo&) override {} // Recorded actions already account for it
+    };
+
+    // Battle info requests are replayed as actions only - nothing to compute
+    class ScriptedPlayer final : public Player {
+        public:
+            void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView&) override {}
+    };
+
+    // Little-endian reads from the replay bytes, throwing if they run out
+    class ByteReader {
+        const string& bytes_;
+        size_t pos_ = 0;
+
+        public:
+            explicit ByteReader(const string& bytes) : bytes_(bytes) {}
+
+            size_t pos() const { return pos_; }
+            void need(const size_t count) const {
+                if (bytes_.size() - pos_ < count) { throw std::runtime_error("Replay is truncated"); }
+            }
+            size_t getUInt(const int width) {
+                need(width);
+                size_t value = 0;
+                for (int i = 0; i < width; ++i) { value |= static_cast<size_t>(static_cast<uint8_t>(bytes_[pos_++])) << (8 * i); }
+                return value;
+            }
+            string getString() {
+                const size_t length = getUInt(2);
+                need(length);
+                string value = bytes_.substr(pos_, length);
+                pos_ += length;
+                return value;
+            }
+    };
+}
+
+Replay Replay::load(const string& path) {
+    GameLogWriter::get().flush(); // The replay may have been recorded by this process and still be pending
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) { throw std::runtime_error("Failed to open replay file: " + path); }
+    const string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return parse(bytes);
+}
+
+Replay Replay::parse(const string& bytes) {
+    ByteReader reader(bytes);
+    reader.need(ReplayFormat::MAGIC.size() + 1);
+    if (!std::equal(ReplayFormat::MAGIC.begin(), ReplayFormat::MAGIC.end(), bytes.begin())) {
+        throw std::runtime_error("Not a replay file");
+    }
+    reader.getUInt(ReplayFormat::MAGIC.size());
+    if (reader.getUInt(1) != ReplayFormat::VERSION) { throw std::runtime_error("Unsupported replay version"); }
+
+    Replay replay;
+    replay.width = reader.getUInt(4);
+    replay.height = reader.getUInt(4);
+    replay.maxSteps = reader.getUInt(4);
+    replay.numShells = reader.getUInt(4);
+    replay.tankCount = reader.getUInt(4);
+    replay.turns = reader.getUInt(4);
+    replay.mapName = reader.getString();
+    replay.name1 = reader.getString();
+    replay.name2 = reader.getString();
+
+    // Every cell takes at least one nibble, so a larger board cannot fit in the file
+    const size_t payload = bytes.size() - reader.pos();
+    if (replay.width == 0 || replay.height == 0 || replay.width > 2 * payload || replay.height > 2 * payload / replay.width) {
+        throw std::runtime_error("Replay board size is invalid");
+    }
+
+    const auto* data = reinterpret_cast<const uint8_t*>(bytes.data()) + reader.pos();
+    NibbleReader map(data, payload);
+    replay.map.assign(static_cast<int>(replay.width), static_cast<int>(replay.height), ' ');
+    for (size_t i = 0; i < replay.map.size(); ++i) {
+        if (map.atEnd()) { throw std::runtime_error("Replay map is truncated"); }
+        const uint8_t nibble = map.get();
+        if (nibble == ReplayFormat::ESCAPE) {
+            const uint8_t low = map.get();
+            if (map.atEnd()) { throw std::runtime_error("Replay map is truncated"); }
+            replay.map[i] = static_cast<char>(low | (map.get() << 4));
+        } else if (nibble < ReplayFormat::MAP_SYMBOLS.size()) {
+            replay.map[i] = ReplayFormat::MAP_SYMBOLS[nibble];
+        } else {
+            throw std::runtime_error("Replay map has an unknown symbol");
+        }
+    }
+
+    // The turns start on the byte after the map. Every tank takes at least one nibble per turn,
+    // and a game without tanks ends before its first turn
+    NibbleReader turns(data + map.bytesUsed(), payload - map.bytesUsed());
+    const size_t turn_nibbles = 2 * (payload - map.bytesUsed());
+    if (replay.tankCount > replay.map.size()) { throw std::runtime_error("Replay tank count is invalid"); }
+    if (replay.tankCount == 0 ? replay.turns != 0 : replay.turns > turn_nibbles / replay.tankCount) {
+        throw std::runtime_error("Replay turns are truncated");
+    }
+    replay.scripts.assign(replay.tankCount, {});
+    for (size_t turn = 0; turn < replay.turns; ++turn) {
+        for (auto& script : replay.scripts) {
+            if (turns.atEnd()) { throw std::runtime_error("Replay turns are truncated"); }
+            uint8_t code = turns.get();
+            if (code == ReplayFormat::ACTION_NONE) { continue; }
+            if (code == ReplayFormat::ESCAPE) { // Ignored action - replayed as requested
+                if (turns.atEnd()) { throw std::runtime_error("Replay turns are truncated"); }
+                code = turns.get();
+            }
+            if (code >= ReplayFormat::ACTION_COUNT) { throw std::runtime_error("Replay has an unknown action"); }
+            script.push_back(ReplayFormat::actionFromCode(code));
+        }
+    }
+    return replay;
+}
+
+// Constructor - sets up the game at turn 0
+ReplayEngine::ReplayEngine(Replay replay) : replay_(std::move(replay)), player_(std::make_unique<ScriptedPlayer>()) {
+    restart();
+}
+
+void ReplayEngine::restart() {
+    gm_ = std::make_unique<GM_209277367_322542887>(false);
+    gm_->setReplayFile(""); // Replaying must not overwrite the recordings
+    gm_->setReplayDir("");
+    gm_->setCycleWindow(0); // The recording has every turn of the game - play them all
+    gm_->setActionBudget(0, 0, 0); // Recorded actions are played as recorded, however long the script takes
+    cursors_.assign(replay_.scripts.size(), 0);
+    createdTanks_ = 0;
+    turn_ = 0;
+    finished_ = false;
+    checkpoints_.clear();
+
+    // The GM creates the tanks in board order, which is the order they were recorded in
+    const TankAlgorithmFactory factory = [this](int, int) -> unique_ptr<TankAlgorithm> {
+        if (createdTanks_ >= replay_.scripts.size()) { throw std::runtime_error("Replay map has more tanks than recorded"); }
+        const size_t tank = createdTanks_++;
+        return std::make_unique<ScriptedTankAlgorithm>(replay_.scripts[tank], cursors_[tank]);
+    };
+
+    const ExtSatelliteView map(replay_.map);
+    gm_->startGame(replay_.width, replay_.height, map, replay_.mapName, replay_.maxSteps, replay_.numShells,
+        *player_, replay_.name1, *player_, replay_.name2, factory, factory);
+    if (createdTanks_ != replay_.scripts.size()) { throw std::runtime_error("Replay map has fewer tanks than recorded"); }
+
+    saveCheckpoint();
+}
+
+void ReplayEngine::saveCheckpoint() {
+    checkpoints_.emplace_back();
+    gm_->saveState(checkpoints_.back().state);
+    checkpoints_.back().cursors = cursors_;
+}
+
+bool ReplayEngine::step() {
+    if (finished_ || gm_->isGameOver()) { return false; }
+    const bool plays = static_cast<size_t>(gm_->getTurn()) < replay_.maxSteps; // At max steps the game ends without a turn
+    const bool running = gm_->playTurn();
+    if (plays) { ++turn_; }
+
+    // Checkpoint every CHECKPOINT_INTERVAL turns, the first time they are reached
+    if (running && turn_ % CHECKPOINT_INTERVAL == 0 && turn_ / CHECKPOINT_INTERVAL == checkpoints_.size()) { saveCheckpoint(); }
+    return running;
+}
+
+void ReplayEngine::seek(const size_t turn) {
+    if (turn < turn_ || finished_) { // Rewind to the last checkpoint at or before turn
+        const Checkpoint& checkpoint = checkpoints_[std::min(turn / CHECKPOINT_INTERVAL, checkpoints_.size() - 1)];
+        gm_->restoreState(checkpoint.state);
+        cursors_ = checkpoint.cursors;
+        turn_ = static_cast<size_t>(checkpoint.state.turn);
+        finished_ = false;
+    }
+    while (turn_ < turn && step()) {}
+}
+
+GameResult ReplayEngine::run() {
+    while (step()) {}
+    finished_ = true;
+    return gm_->finishGame();
+}
+
+} // namespace GameManager_209277367_322542887
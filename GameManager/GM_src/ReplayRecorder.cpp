@@ -0,0 +1,77 @@
+#include "ReplayRecorder.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace GameManager_209277367_322542887 {
+
+namespace {
+    void putU16(string& out, const size_t value) {
+        for (int i = 0; i < 2; ++i) { out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF)); }
+    }
+
+    void putU32(string& out, const size_t value) {
+        for (int i = 0; i < 4; ++i) { out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF)); }
+    }
+
+    void putString(string& out, const string& value) {
+        const size_t length = std::min<size_t>(value.size(), 0xFFFF);
+        putU16(out, length);
+        out.append(value, 0, length);
+    }
+}
+
+void ReplayRecorder::begin(const Gameboard& map, const size_t max_steps, const size_t num_shells,
+    const size_t tank_count, const string& map_name, const string& name1, const string& name2) {
+    header_.assign(ReplayFormat::MAGIC.begin(), ReplayFormat::MAGIC.end());
+    header_.push_back(static_cast<char>(ReplayFormat::VERSION));
+    putU32(header_, map.getWidth());
+    putU32(header_, map.getHeight());
+    putU32(header_, max_steps);
+    putU32(header_, num_shells);
+    putU32(header_, tank_count);
+    headerTurnsOffset_ = header_.size();
+    putU32(header_, 0); // Turn count, patched by finish()
+    putString(header_, map_name);
+    putString(header_, name1);
+    putString(header_, name2);
+
+    // Known symbols take one nibble, anything else is escaped as a raw byte
+    map_.clear();
+    for (size_t i = 0; i < map.size(); ++i) {
+        const char cell = map[i];
+        const auto symbol = std::find(ReplayFormat::MAP_SYMBOLS.begin(), ReplayFormat::MAP_SYMBOLS.end(), cell);
+        if (symbol != ReplayFormat::MAP_SYMBOLS.end()) {
+            map_.put(static_cast<uint8_t>(symbol - ReplayFormat::MAP_SYMBOLS.begin()));
+        } else {
+            map_.put(ReplayFormat::ESCAPE);
+            map_.put(static_cast<uint8_t>(cell) & 0x0F);
+            map_.put(static_cast<uint8_t>(cell) >> 4);
+        }
+    }
+
+    turns_.clear();
+    turnCount_ = 0;
+}
+
+void ReplayRecorder::recordAction(const ActionRequest action, const bool valid) {
+    if (!valid) { turns_.put(ReplayFormat::ESCAPE); } // Ignored actions cost one extra nibble
+    turns_.put(ReplayFormat::actionCode(action));
+}
+
+void ReplayRecorder::recordNoAction() { turns_.put(ReplayFormat::ACTION_NONE); }
+
+string ReplayRecorder::finish() {
+    string replay = std::move(header_);
+    for (int i = 0; i < 4; ++i) { replay[headerTurnsOffset_ + i] = static_cast<char>((turnCount_ >> (8 * i)) & 0xFF); }
+    replay += map_.bytes();
+    replay += turns_.bytes();
+
+    header_.clear();
+    map_.clear();
+    turns_.clear();
+    turnCount_ = 0;
+    return replay;
+}
+
+} // namespace GameManager_209277367_322542887
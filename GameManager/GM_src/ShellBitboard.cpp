@@ -0,0 +1,89 @@
+#include "../GM_include/ShellBitboard.h"
+
+#include <algorithm>
+
+namespace GameManager_209277367_322542887 {
+
+void ShellBitboard::assign(const Gameboard& board) {
+    width_ = board.getWidth();
+    height_ = board.getHeight();
+    columnMask_ = (height_ == MAX_SIDE) ? ~uint64_t{0} : (uint64_t{1} << height_) - 1;
+    activeDirections_ = 0;
+    firstColumn_ = 0;
+    lastColumn_ = -1;
+
+    for (auto& plane : board_) { plane.fill(0); }
+    for (auto& plane : shells_) { plane.fill(0); }
+    for (int x = 0; x < width_; ++x) {
+        for (int y = 0; y < height_; ++y) { board_[planeOf(board.at(x, y))][x] |= uint64_t{1} << y; }
+    }
+}
+
+void ShellBitboard::shift(const Bits& from, Bits& to, const Direction dir) const {
+    const auto [dx, dy] = directionOffsets[dirIndex(dir)];
+    const int up = (dy > 0) ? 1 : (dy < 0) ? height_ - 1 : 0; // Rotation of a column, towards higher y
+    for (int x = firstColumn_; x <= lastColumn_; ++x) {
+        const uint64_t column = from[x];
+        const uint64_t moved = (up == 0) ? column : ((column << up) | (column >> (height_ - up))) & columnMask_;
+        to[x + dx < 0 ? width_ - 1 : x + dx >= width_ ? 0 : x + dx] = moved;
+    }
+}
+
+bool ShellBitboard::advance(const ShellPool& pool) {
+    // Only the columns and directions used last time can hold bits
+    const auto clear = [this](Bits& bits) { std::fill(bits.begin() + firstColumn_, bits.begin() + lastColumn_ + 1, 0); };
+    for (int dir = 0; dir < DIRECTION_COUNT; ++dir) {
+        if (activeDirections_ >> dir & 1) { clear(shells_[dir]); }
+    }
+    clear(shellCells_);
+    activeDirections_ = 0;
+
+    // Columns touched: every column holding a shell and its neighbors, all of them if that wraps
+    int min_x = width_, max_x = -1;
+    for (int slot = pool.nextAlive(0); slot < pool.slots(); slot = pool.nextAlive(slot + 1)) {
+        min_x = std::min(min_x, pool.getX(slot));
+        max_x = std::max(max_x, pool.getX(slot));
+    }
+    const bool wraps = min_x == 0 || max_x == width_ - 1;
+    firstColumn_ = wraps ? 0 : min_x - 1;
+    lastColumn_ = wraps ? width_ - 1 : max_x + 1;
+
+    for (int slot = pool.nextAlive(0); slot < pool.slots(); slot = pool.nextAlive(slot + 1)) {
+        const int x = pool.getX(slot);
+        const uint64_t mask = uint64_t{1} << pool.getY(slot);
+        if (shellCells_[x] & mask) { return false; } // Two shells in one cell
+        shellCells_[x] |= mask;
+        const int dir = dirIndex(pool.getDirection(slot));
+        shells_[dir][x] |= mask;
+        activeDirections_ |= 1u << dir;
+    }
+
+    // Move every direction, checking that no two shells fly into the same cell
+    clear(targeted_);
+    for (int dir = 0; dir < DIRECTION_COUNT; ++dir) {
+        if (!(activeDirections_ >> dir & 1)) { continue; }
+        clear(targets_[dir]);
+        shift(shells_[dir], targets_[dir], static_cast<Direction>(dir));
+        for (int x = firstColumn_; x <= lastColumn_; ++x) {
+            if (targeted_[x] & targets_[dir][x]) { return false; }
+            targeted_[x] |= targets_[dir][x];
+        }
+    }
+
+    // Every shell must sit on a plain '*' and fly into a cell holding no shell or tank mark
+    for (int x = firstColumn_; x <= lastColumn_; ++x) {
+        if (shellCells_[x] & ~board_[SHELL][x]) { return false; }
+        if (targeted_[x] & (shellCells_[x] | board_[SHELL][x] | board_[OTHER][x])) { return false; }
+    }
+
+    for (int x = firstColumn_; x <= lastColumn_; ++x) {
+        wallHits_[x] = targeted_[x] & board_[WALL][x];
+        weakWallHits_[x] = targeted_[x] & board_[WEAK_WALL][x];
+        tankHits_[x] = targeted_[x] & (board_[TANK1][x] | board_[TANK2][x]);
+        landed_[x] = targeted_[x] & (board_[EMPTY][x] | board_[MINE][x]);
+        landedOnMine_[x] = targeted_[x] & board_[MINE][x];
+    }
+    return true;
+}
+
+} // namespace GameManager_209277367_322542887
@@ -0,0 +1,75 @@
+#include "TaskPool.h"
+
+#include <utility>
+
+namespace GameManager_209277367_322542887 {
+
+// Constructor - starts threads - 1 workers
+TaskPool::TaskPool(const size_t threads) {
+    for (size_t i = 1; i < threads; ++i) { workers_.emplace_back(&TaskPool::workerLoop, this); }
+}
+
+// Destructor - stops the workers and joins them
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    workReady_.notify_all();
+    for (auto& worker : workers_) { worker.join(); }
+}
+
+void TaskPool::run(const size_t count, const function<void(size_t)>& task) {
+    if (count == 0) { return; }
+    {
+        std::lock_guard lock(mutex_);
+        task_ = &task;
+        taskCount_ = count;
+        nextTask_ = 0;
+        busyWorkers_ = workers_.size();
+        ++generation_;
+    }
+    workReady_.notify_all();
+
+    work(); // The caller takes indices too
+
+    std::exception_ptr error;
+    {
+        std::unique_lock lock(mutex_);
+        workDone_.wait(lock, [this] { return busyWorkers_ == 0; });
+        task_ = nullptr;
+        error = std::exchange(error_, nullptr);
+    }
+    if (error) { std::rethrow_exception(error); }
+}
+
+void TaskPool::work() {
+    for (size_t i = nextTask_.fetch_add(1); i < taskCount_; i = nextTask_.fetch_add(1)) {
+        try { (*task_)(i); }
+        catch (...) {
+            std::lock_guard lock(mutex_);
+            if (!error_) { error_ = std::current_exception(); }
+            nextTask_ = taskCount_; // Skip the remaining indices
+        }
+    }
+}
+
+// Worker thread - joins every loop posted by run()
+void TaskPool::workerLoop() {
+    size_t seen = 0; // Last loop this worker joined
+    for (;;) {
+        {
+            std::unique_lock lock(mutex_);
+            workReady_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) { return; }
+            seen = generation_;
+        }
+
+        work();
+
+        std::lock_guard lock(mutex_);
+        if (--busyWorkers_ == 0) { workDone_.notify_one(); }
+    }
+}
+
+} // namespace GameManager_209277367_322542887
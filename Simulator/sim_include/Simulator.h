@@ -8,9 +8,14 @@
 #include <fstream>
 #include <iostream>
 #include <optional>
+#include <map>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
 #include "AbstractGameManager.h"
 #include "../UserCommon/UC_include/ExtSatelliteView.h"
+#include "../UserCommon/UC_include/ExtGameResult.h"
+#include "../UserCommon/UC_include/BudgetedGameManager.h"
 #include "logger.h"
 
 namespace fs = std::filesystem;
@@ -26,6 +31,9 @@ public:
     Simulator& operator=(Simulator&&) = delete;
     virtual ~Simulator() = default;
 
+    // getAction() budgets passed on to every game manager that takes them (0 for none)
+    void setActionBudget(uint64_t call_microseconds, uint64_t game_milliseconds, uint64_t timeout_milliseconds);
+
 protected:
     struct MapData {
         int numShells;
@@ -44,6 +52,13 @@ protected:
 
     MapData readMap(const std::string& file_path);
     string timestamp();
+    void configureGameManager(AbstractGameManager& gm) const; // Apply the settings above to a new game manager
+    // Thread safe; call after gm.run() with the names of the algorithms of player 1 and 2. Returns
+    // true if the game abandoned getAction() calls - the game manager's and the algorithms'
+    // libraries must then stay loaded (see callsLeftRunning())
+    bool collectExtGameResult(const AbstractGameManager& gm, const string& name1, const string& name2);
+    bool callsLeftRunning() const { return callsLeftRunning_; } // Any game so far abandoned a call
+    void reportExtGameResults(); // Log the phase timings and the time budget overruns collected
 
 private:
     bool extractLineValue(const std::string& line, int& value, const std::string& key, const size_t line_number,
@@ -54,6 +69,24 @@ private:
     bool checkForExtras(int extraRows, int extraCols, ofstream &inputErrors);
 
     std::optional<MapData> map_;
+
+    struct AlgorithmBudgetStats {
+        size_t games = 0;
+        uint64_t actionCpuNanoseconds = 0;
+        size_t actionOverruns = 0;
+        size_t timedOutCalls = 0;
+        size_t forfeits = 0;
+    };
+
+    uint64_t actionBudgetUs_ = 0;
+    uint64_t gameBudgetMs_ = 0;
+    uint64_t actionTimeoutMs_ = 0;
+    std::atomic<bool> callsLeftRunning_ = false;
+
+    std::mutex extResultsMutex_;
+    ExtGameResult phaseTotals_; // Sum over the timed games
+    size_t timedGames_ = 0;
+    std::map<string, AlgorithmBudgetStats> budgetStats_; // Per algorithm name, over the budgeted games
 };
 
 #endif // SIMULATOR_H
@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <vector>
 #include <optional>
+#include <cstdint>
 
 class CmdParser {
 public:
@@ -21,6 +22,10 @@ public:
         std::string algorithm2File;
         std::string algorithmsFolder;
         std::optional<int> numThreads;
+        // getAction() budgets passed on to the game managers, 0 for none
+        uint64_t actionBudgetUs = 0;
+        uint64_t gameBudgetMs = 0;
+        uint64_t actionTimeoutMs = 0;
         bool verbose = false;
 
         // Logger
@@ -9,6 +9,7 @@
 #include "AlgorithmRegistrar.h"
 #include "GameManagerRegistrar.h"
 #include "Simulator.h"
+#include "../UserCommon/UC_include/BoardExporter.h"
 #include "GameResult.h"
 #include "AbstractGameManager.h"
 
@@ -73,6 +74,12 @@ private:
             return snap; // Return empty snapshot
         }
 
+        // Views that export their board in bulk - one virtual call instead of one per cell
+        if (const auto* exporter = dynamic_cast<const BoardExporter*>(gr.gameState.get());
+            exporter && exporter->exportRows(cols, rows, snap.board)) {
+            return snap;
+        }
+
         snap.board.resize(rows, std::vector<char>(cols));
         for (size_t y = 0; y < rows; ++y) {
             for (size_t x = 0; x < cols; ++x) {
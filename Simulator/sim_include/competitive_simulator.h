@@ -11,6 +11,7 @@
 #include "AlgorithmRegistrar.h"
 #include "../../common/GameManagerRegistration.h"
 #include "Simulator.h"
+#include "../UserCommon/UC_include/ReusableGameManager.h"
 
 using std::string, std::vector, std::unordered_map, std::mutex, std::shared_ptr, std::lock_guard, std::pair,
     std::unique_ptr, std::ofstream, std::ifstream, std::sort, std::cout, std::endl, std::exception, std::make_shared,
@@ -60,7 +61,7 @@ private:
     void runGames();
     void ensureAlgorithmLoaded(const string& name);
     shared_ptr<AlgorithmRegistrar::AlgorithmAndPlayerFactories> getValidatedAlgorithm(const string& name);
-    void runSingleGame(const GameTask& task);
+    void runSingleGame(const GameTask& task, unique_ptr<AbstractGameManager>& gm); // gm: the worker's pooled instance
     void updateScore(const string& winnerName, const string& loserName, bool tie);
     void writeOutput(const string& outFolder, const string& mapFolder, const string& gmSoName);
     std::unique_ptr<AbstractGameManager> createGameManager();
@@ -1,8 +1,39 @@
 #include "Simulator.h"
 
+#include <algorithm>
+
 Simulator::Simulator(bool verbose, size_t numThreads)
     : verbose_(verbose), numThreads_(numThreads), logger_(utils::Logger::get()) {}
 
+/**
+ * @brief Sets the getAction() budgets of the games to come.
+ *
+ * Passed to every game manager implementing BudgetedGameManager when it is created. If all are
+ * 0 (the default), game managers keep their own settings.
+ *
+ * @param call_microseconds CPU budget of one getAction() call.
+ * @param game_milliseconds CPU budget of all getAction() calls of one player in a game.
+ * @param timeout_milliseconds Wall time after which a getAction() call is abandoned.
+ */
+void Simulator::setActionBudget(const uint64_t call_microseconds, const uint64_t game_milliseconds,
+    const uint64_t timeout_milliseconds) {
+    actionBudgetUs_ = call_microseconds;
+    gameBudgetMs_ = game_milliseconds;
+    actionTimeoutMs_ = timeout_milliseconds;
+}
+
+/**
+ * @brief Applies the simulator settings to a game manager just created.
+ *
+ * @param gm Game manager that has not played yet.
+ */
+void Simulator::configureGameManager(AbstractGameManager& gm) const {
+    if (actionBudgetUs_ == 0 && gameBudgetMs_ == 0 && actionTimeoutMs_ == 0) { return; }
+    if (auto* budgeted = dynamic_cast<BudgetedGameManager*>(&gm)) {
+        budgeted->setActionBudget(actionBudgetUs_, gameBudgetMs_, actionTimeoutMs_);
+    }
+}
+
 /**
  * @brief Extracts an integer value from a configuration line in the map file.
  *
@@ -248,3 +279,69 @@ string Simulator::timestamp() {
     ss << std::put_time(std::localtime(&t), "%Y%m%d_%H%M%S");
     return ss.str();
 }
+
+/**
+ * @brief Adds the ExtGameResult of a finished game to the simulation totals.
+ *
+ * Only game managers implementing ExtGameResultSource report one; other game managers are
+ * ignored. Phase timings are summed over the games that were timed (built with profiling),
+ * and the time budget figures per algorithm over the games that had a budget.
+ *
+ * @param gm Game manager whose run() just returned.
+ * @param name1 Algorithm of player 1.
+ * @param name2 Algorithm of player 2.
+ * @return true if the game abandoned getAction() calls that may still be running.
+ */
+bool Simulator::collectExtGameResult(const AbstractGameManager& gm, const string& name1, const string& name2) {
+    const auto* source = dynamic_cast<const ExtGameResultSource*>(&gm);
+    if (!source) { return false; }
+    const ExtGameResult& result = source->getExtGameResult();
+    const bool calls_left_running = result.budgeted && result.timedOutCalls[0] + result.timedOutCalls[1] > 0;
+    if (calls_left_running) { callsLeftRunning_ = true; }
+
+    std::lock_guard<std::mutex> lock(extResultsMutex_);
+    if (result.timed) {
+        for (size_t i = 0; i < ExtGameResult::PHASE_COUNT; ++i) { phaseTotals_.phaseNanoseconds[i] += result.phaseNanoseconds[i]; }
+        ++timedGames_;
+    }
+    if (result.budgeted) {
+        for (size_t player = 0; player < 2; ++player) {
+            AlgorithmBudgetStats& stats = budgetStats_[player == 0 ? name1 : name2];
+            if (player == 0 || name1 != name2) { ++stats.games; } // An algorithm playing itself plays one game
+            stats.actionCpuNanoseconds += result.actionCpuNanoseconds[player];
+            stats.actionOverruns += result.actionOverruns[player];
+            stats.timedOutCalls += result.timedOutCalls[player];
+            stats.forfeits += result.forfeited[player];
+        }
+    }
+    return calls_left_running;
+}
+
+/**
+ * @brief Logs where the timed games spent their time, and how each algorithm kept its budget.
+ *
+ * Phase timings are logged if any game was timed. Every budgeted algorithm gets an info line
+ * with its getAction() CPU time, and a warning if it overran the per-call or per-game budget.
+ */
+void Simulator::reportExtGameResults() {
+    for (const auto& [name, stats] : budgetStats_) {
+        logger_.info("Algorithm ", name, ": ", std::fixed, std::setprecision(3), stats.actionCpuNanoseconds / 1e6,
+                     " ms of getAction() CPU time over ", stats.games, " game(s)");
+        if (stats.actionOverruns > 0 || stats.forfeits > 0) {
+            logger_.reportWarn("Algorithm ", name, " exceeded its time budget: ", stats.actionOverruns,
+                               " getAction() call(s) played as DoNothing, ", stats.timedOutCalls,
+                               " call(s) abandoned after the time limit, ", stats.forfeits, " forfeit(s)");
+        }
+    }
+
+    if (timedGames_ == 0) { return; }
+
+    const double total = static_cast<double>(std::max<uint64_t>(phaseTotals_.totalNanoseconds(), 1));
+    std::ostringstream phases;
+    for (size_t i = 0; i < ExtGameResult::PHASE_COUNT; ++i) {
+        const uint64_t ns = phaseTotals_.phaseNanoseconds[i];
+        phases << (i ? ", " : "") << ExtGameResult::phaseNames[i] << " " << std::fixed << std::setprecision(3)
+               << ns / 1e6 << " ms (" << std::setprecision(1) << 100.0 * ns / total << "%)";
+    }
+    logger_.info("Phase timings over ", timedGames_, " game(s): ", phases.str());
+}
@@ -16,11 +16,13 @@ namespace {
 
     // Allowed argument keys for comparative and competition modes
     static const std::vector<std::string> validComparativeKeys = {
-        "game_map", "game_managers_folder", "algorithm1", "algorithm2", "num_threads"
+        "game_map", "game_managers_folder", "algorithm1", "algorithm2", "num_threads",
+        "action_budget_us", "game_budget_ms", "action_timeout_ms"
     };
 
     static const std::vector<std::string> validCompetitionKeys = {
-        "game_maps_folder", "game_manager", "algorithms_folder", "num_threads"
+        "game_maps_folder", "game_manager", "algorithms_folder", "num_threads",
+        "action_budget_us", "game_budget_ms", "action_timeout_ms"
     };
 
     /**
@@ -122,6 +124,32 @@ namespace {
         }
     }
 
+    /**
+     * @brief Parses and validates an optional time budget argument strictly.
+     *
+     * Ensures that the argument value is a non-negative integer consisting of digits only.
+     * Defaults to 0 (no budget) if the argument is missing. If the provided value is invalid,
+     * returns false without modifying the output parameter.
+     *
+     * @param kv Map of parsed key-value arguments.
+     * @param key Argument to parse.
+     * @param out Reference to an integer that receives the parsed budget.
+     * @return True if parsing succeeds, false otherwise.
+     */
+    static bool parseBudgetStrict(const std::unordered_map<std::string,std::string>& kv, const std::string& key, uint64_t& out) {
+        auto it = kv.find(key);
+        if (it == kv.end()) { out = 0; return true; }
+        const std::string& s = it->second;
+        if (s.empty() || !std::all_of(s.begin(), s.end(), [](unsigned char c){ return std::isdigit(c); })) return false;
+        try {
+            out = std::stoull(s);
+            return true;
+        } catch (const std::out_of_range& e) {
+            std::cerr << "Number out of range: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
     // ==== small utils (add next to your existing helpers) ====
     inline std::string absoluteForMsg(const std::string& p) {
         std::error_code ec;
@@ -366,6 +394,8 @@ namespace {
  *
  * Also handles optional arguments:
  *   - num_threads (must be a positive integer, default = 1)
+ *   - action_budget_us, game_budget_ms, action_timeout_ms (getAction() budgets,
+ *     non-negative integers, default = 0 for none)
  *   - -verbose flag for verbose output
  *
  * The parser reports and fails on:
@@ -426,6 +456,11 @@ CmdParser::ParseResult CmdParser::parse(int argc, char** argv) {
     if (!parseNumThreadsStrict(nz.kv, threads)) errors.emplace_back("Invalid value for num_threads (must be a positive integer).");
     res.numThreads = threads;
 
+    // Time budget validation (default to 0, no budget, when absent)
+    if (!parseBudgetStrict(nz.kv, "action_budget_us", res.actionBudgetUs)) errors.emplace_back("Invalid value for action_budget_us (must be a non-negative integer).");
+    if (!parseBudgetStrict(nz.kv, "game_budget_ms", res.gameBudgetMs)) errors.emplace_back("Invalid value for game_budget_ms (must be a non-negative integer).");
+    if (!parseBudgetStrict(nz.kv, "action_timeout_ms", res.actionTimeoutMs)) errors.emplace_back("Invalid value for action_timeout_ms (must be a non-negative integer).");
+
     if (!errors.empty()) {
         std::string msg;
         for (auto& e : errors) msg += e + '\n';
@@ -452,9 +487,11 @@ void CmdParser::printUsage() {
         << "  ./simulator_<ids> -comparative "
            "game_map=<file> game_managers_folder=<folder> "
            "algorithm1=<file> algorithm2=<file> "
-           "[num_threads=<n>] [-verbose] [-logger[=<path>]] [-debug]\n\n"
+           "[num_threads=<n>] [action_budget_us=<n>] [game_budget_ms=<n>] [action_timeout_ms=<n>] "
+           "[-verbose] [-logger[=<path>]] [-debug]\n\n"
         << "  ./simulator_<ids> -competition "
            "game_maps_folder=<folder> game_manager=<file> "
            "algorithms_folder=<folder> "
-           "[num_threads=<n>] [-verbose] [-logger[=<path>]] [-debug]\n";
+           "[num_threads=<n>] [action_budget_us=<n>] [game_budget_ms=<n>] [action_timeout_ms=<n>] "
+           "[-verbose] [-logger[=<path>]] [-debug]\n";
 }
@@ -52,7 +52,7 @@ ComparativeSimulator::~ComparativeSimulator() {
     }
 
     for (auto& handle : algoHandles_) {
-        if (handle) {
+        if (handle && !callsLeftRunning()) { // Abandoned getAction() calls may still run algorithm code
             dlclose(handle);
         }
     }
@@ -118,6 +118,7 @@ int ComparativeSimulator::run(const string& mapPath,
 
     // Write output to file
     writeOutput(mapPath, algorithmSoPath1, algorithmSoPath2, gmFolder);
+    reportExtGameResults();
     logger_.info("Comparative simulation completed.");
 
     return 0;
@@ -311,7 +312,7 @@ void ComparativeSimulator::runGames() {
  * result is stored in `allResults`.
  *
  * After execution, the GameManager entry is removed from the registrar and the
- * shared object handle is closed.
+ * shared object handle is closed, unless the game left getAction() calls running.
  *
  * @param gmPath Path to the GameManager `.so` file to load and execute.
  */
@@ -322,6 +323,7 @@ void ComparativeSimulator::runSingleGame(const path& gmPath) {
     void* gm_handle = loadGameManagerSO(gmPath);
     if (errorHandle(!gm_handle, "Failed to load GameManager .so file: ", gm_handle, gmPath.string())) { return; }
    
+    bool keepLoaded = false; // The game left getAction() calls running
     {
         unique_ptr<AbstractGameManager> gameManager;
         bool createdGameManager = false;
@@ -334,6 +336,7 @@ void ComparativeSimulator::runSingleGame(const path& gmPath) {
             // Create the GameManager instance
             gameManager = gm.create(verbose_);
             createdGameManager = (gameManager != nullptr);
+            if (createdGameManager) { configureGameManager(*gameManager); }
             logger_.debug("Thread ", std::this_thread::get_id(), " created GameManager instance for: ", gm_name);
         }
         
@@ -355,13 +358,17 @@ void ComparativeSimulator::runSingleGame(const path& gmPath) {
         logger_.info("Thread ", std::this_thread::get_id(), " starting game with GameManager: ", gm_name);
         GameResult result = gameManager->run(mapData_.cols, mapData_.rows, *mapData_.satelliteView, mapData_.name,
             mapData_.maxSteps, mapData_.numShells, *player1, name1, *player2, name2, tankAlgorithmFactory1, tankAlgorithmFactory2);
+        if (collectExtGameResult(*gameManager, name1, name2)) { // Its abandoned calls may still run its code
+            logger_.reportWarn("GameManager ", gm_name, " abandoned getAction() calls, keeping its library loaded");
+            keepLoaded = true;
+        }
 
-        // Store the result in allResults
+        // Store the result in allResults - the snapshot is taken outside the lock
         {
-            lock_guard<mutex> lock(allResultsMutex_);
             SnapshotGameResult snap = makeSnapshot(result, mapData_.rows, mapData_.cols);
-            if (errorHandle(snap.board.empty(), "Empty board in GameResult for GameManager: ", gm_handle, gm_name)) { return; }
-            allResults.emplace_back(snap, gm_name);
+            if (errorHandle(snap.board.empty(), "Empty board in GameResult for GameManager: ", keepLoaded ? nullptr : gm_handle, gm_name)) { return; }
+            lock_guard<mutex> lock(allResultsMutex_);
+            allResults.emplace_back(std::move(snap), gm_name);
         }
     
         // Remove the GameManager entry from the registrar
@@ -376,7 +383,7 @@ void ComparativeSimulator::runSingleGame(const path& gmPath) {
     
 
     // Remove the GameManager entry from the registrar and close the handle
-    dlclose(gm_handle); 
+    if (!keepLoaded) { dlclose(gm_handle); }
 }
 
 /**
@@ -80,6 +80,7 @@ int CompetitiveSimulator::run(const string& mapsFolder,
     scheduleGames(maps); 
     runGames(); 
     writeOutput(algorithmsFolder, mapsFolder, gameManagerSoPath); 
+    reportExtGameResults();
 
     logger_.info("Competitive simulation completed.");
     return 0;
@@ -325,8 +326,9 @@ void CompetitiveSimulator::runGames() {
     size_t threadCount = min(numThreads_, scheduledGames_.size()); // Deciede number of threads to use based on scheduled games
     logger_.info("Running games using ", threadCount, " thread(s)...");
     if (threadCount == 1) { // Main thread runs all games sequentially
+        unique_ptr<AbstractGameManager> gm; // Reused across games if the GameManager allows it
         for (const auto& task : scheduledGames_) {
-            runSingleGame(task); // Run all games sequentially if only one thread
+            runSingleGame(task, gm); // Run all games sequentially if only one thread
         }
         return;
     }
@@ -338,10 +340,11 @@ void CompetitiveSimulator::runGames() {
     // Worker workflow
     auto worker = [&]() {
         logger_.debug("Thread ", std::this_thread::get_id(), " started.");
+        unique_ptr<AbstractGameManager> gm; // This worker's GameManager, reused across games if it allows it
         while (true) {
             size_t idx = nextTask.fetch_add(1, std::memory_order_relaxed);
             if (idx >= scheduledGames_.size()) break;
-            runSingleGame(scheduledGames_[idx]);
+            runSingleGame(scheduledGames_[idx], gm);
             logger_.debug("Thread ", std::this_thread::get_id(), " completed game ", idx + 1, "/", scheduledGames_.size());
         }
     };
@@ -371,9 +374,14 @@ void CompetitiveSimulator::runGames() {
  * If the game map fails to load, or if algorithms are not properly registered,
  * the game is skipped and the error is logged.
  *
+ * The GameManager is created on the worker's first game. If it implements
+ * ReusableGameManager it is reset after every game and kept for the worker's next one,
+ * so its buffers are allocated once per worker instead of once per game.
+ *
  * @param task Game configuration including map path and participating algorithms.
+ * @param gm The worker's GameManager, created here if null, reset or destroyed after the game.
  */
-void CompetitiveSimulator::runSingleGame(const GameTask& task) {
+void CompetitiveSimulator::runSingleGame(const GameTask& task, unique_ptr<AbstractGameManager>& gm) {
     fs::path mapPath = task.mapPath;
     MapData mapData = readMap(mapPath);
     if (mapData.failedInit) {
@@ -410,7 +418,7 @@ void CompetitiveSimulator::runSingleGame(const GameTask& task) {
         auto player2 = algo2->createPlayer(2, mapData.cols, mapData.rows, mapData.maxSteps, mapData.numShells);
 
         // Run game manager with players and factories
-        auto gm = createGameManager();
+        if (!gm) { gm = createGameManager(); }
         if (!gm) {
             logger_.reportWarn("Failed to create game manager for map: ", mapPath.string());
             return;
@@ -421,6 +429,11 @@ void CompetitiveSimulator::runSingleGame(const GameTask& task) {
             mapData.maxSteps, mapData.numShells,*player1, name1, *player2, name2,
             algo1->getTankAlgorithmFactory(),algo2->getTankAlgorithmFactory()
         );
+        collectExtGameResult(*gm, name1, name2); // Abandoned calls can keep running - the libraries are RTLD_NODELETE
+
+        // Release the players and algorithms before they are destroyed and possibly unloaded
+        if (auto* reusable = dynamic_cast<ReusableGameManager*>(gm.get())) { reusable->reset(); }
+        else { gm.reset(); } // Not reusable - the next game creates a new one
         
 
         // Use GameResult to update scores
@@ -497,10 +510,12 @@ void CompetitiveSimulator::writeOutput(const string& outFolder,
 /**
  * @brief Creates a new instance of the loaded GameManager using the factory.
  *
- * @return unique_ptr to a new AbstractGameManager instance.
+ * @return unique_ptr to a new AbstractGameManager instance, with the simulator settings applied.
  */
 unique_ptr<AbstractGameManager> CompetitiveSimulator::createGameManager() {
-    return gameManagerFactory_(verbose_);
+    unique_ptr<AbstractGameManager> gm = gameManagerFactory_(verbose_);
+    if (gm) { configureGameManager(*gm); }
+    return gm;
 }
 
 /**
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+using std::vector, std::size_t;
+
+namespace UserCommon_209277367_322542887 {
+
+// Implemented by satellite views that can copy their whole board out in one call. A reader
+// holding a view made by another module (a game manager's final gameState) finds it with
+// dynamic_cast and copies through the virtual exportRows(), which runs in the module that
+// made the view, so it never depends on how the reader's headers lay that view out.
+// Modules built against an older version see a different interface: extend it by adding a
+// new interface, never by changing this one.
+class BoardExporter {
+    public:
+        // Rule of 5
+        BoardExporter() = default;
+        BoardExporter(const BoardExporter&) = default;
+        BoardExporter& operator=(const BoardExporter&) = default;
+        BoardExporter(BoardExporter&&) noexcept = default;
+        BoardExporter& operator=(BoardExporter&&) noexcept = default;
+        virtual ~BoardExporter() = default;
+
+        // Copy the board into rows, one vector per row, if it is width x height; false (rows
+        // untouched) otherwise
+        virtual bool exportRows(size_t width, size_t height, vector<vector<char>>& rows) const = 0;
+};
+
+} // namespace UserCommon_209277367_322542887
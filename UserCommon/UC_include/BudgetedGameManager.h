@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+namespace UserCommon_209277367_322542887 {
+
+// Implemented by game managers that limit the time the tank algorithms may take in getAction().
+// The simulator passes its command-line budgets on to every game manager it creates.
+class BudgetedGameManager {
+    public:
+        // Rule of 5
+        BudgetedGameManager() = default;
+        BudgetedGameManager(const BudgetedGameManager&) = default;
+        BudgetedGameManager& operator=(const BudgetedGameManager&) = default;
+        BudgetedGameManager(BudgetedGameManager&&) noexcept = default;
+        BudgetedGameManager& operator=(BudgetedGameManager&&) noexcept = default;
+        virtual ~BudgetedGameManager() = default;
+
+        // Budgets of the games started after the call, 0 for none: CPU time of one call, CPU time
+        // of all one player's calls in a game, and wall time after which a call is abandoned
+        virtual void setActionBudget(uint64_t call_microseconds, uint64_t game_milliseconds,
+            uint64_t timeout_milliseconds) = 0;
+};
+
+} // namespace UserCommon_209277367_322542887
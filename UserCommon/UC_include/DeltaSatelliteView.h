@@ -0,0 +1,34 @@
+#pragma once
+
+# include "OverlaySatelliteView.h"
+# include <vector>
+
+using std::vector;
+
+namespace UserCommon_209277367_322542887 {
+
+// Overlay view that also lists the cells which may differ from the view the same player got
+// with its previous battle info (the previous and current overlay cells included), so a player
+// that keeps its own copy of the board can re-read only those cells. Cells are row-major
+// indices (y * width + x). Players find it with dynamic_cast; getObjectAt works as usual.
+class DeltaSatelliteView final : public OverlaySatelliteView {
+    size_t width_;
+    const vector<size_t>* changedCells_; // nullptr if the whole board must be read
+
+    public:
+        // Rule of 5
+        DeltaSatelliteView(const Gameboard& map, size_t overlay_x, size_t overlay_y, char overlay,
+            const vector<size_t>* changed_cells);
+        ~DeltaSatelliteView() override = default; // Default destructor
+        DeltaSatelliteView(const DeltaSatelliteView&) = delete;
+        DeltaSatelliteView& operator=(const DeltaSatelliteView&) = delete;
+        DeltaSatelliteView(DeltaSatelliteView&&) noexcept = delete;
+        DeltaSatelliteView& operator=(DeltaSatelliteView&&) noexcept = delete;
+
+        // False for the player's first view (or after the game was restored) - read every cell
+        bool hasChanges() const { return changedCells_ != nullptr; }
+        const vector<size_t>& getChangedCells() const { return *changedCells_; } // Requires hasChanges()
+        size_t getWidth() const { return width_; }
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -1,26 +1,54 @@
 #pragma once
 
-#include <map>
+#include <array>
 #include <utility>
 
-using std::pair, std::map;
+using std::pair;
 
 namespace UserCommon_209277367_322542887 {
 
 enum class Direction { U, UR, R, DR, D, DL, L, UL };
 
-// Mapping of directions to their respective coordinate changes
-static const map<Direction, std::pair<int, int>> directionMap = {
-    {Direction::U, {0, -1}},
-    {Direction::UR, {1, -1}},
-    {Direction::R, {1, 0}},
-    {Direction::DR, {1, 1}},
-    {Direction::D, {0, 1}},
-    {Direction::DL, {-1, 1}},
-    {Direction::L, {-1, 0}},
-    {Direction::UL, {-1, -1}}
+inline constexpr int DIRECTION_COUNT = 8;
+
+// Index of a direction in the tables below (U = 0, clockwise in 45 degree steps)
+constexpr int dirIndex(const Direction dir) { return static_cast<int>(dir); }
+
+// Coordinate change of one step in each direction, indexed by dirIndex
+inline constexpr std::array<pair<int, int>, DIRECTION_COUNT> directionOffsets = {{
+    {0, -1},  // U
+    {1, -1},  // UR
+    {1, 0},   // R
+    {1, 1},   // DR
+    {0, 1},   // D
+    {-1, 1},  // DL
+    {-1, 0},  // L
+    {-1, -1}  // UL
+}};
+
+// Direction rotated by k * 45 degrees clockwise, indexed [dirIndex][k] (k = 0..7)
+inline constexpr auto directionRotations = [] {
+    std::array<std::array<Direction, DIRECTION_COUNT>, DIRECTION_COUNT> table{};
+    for (int d = 0; d < DIRECTION_COUNT; ++d) {
+        for (int k = 0; k < DIRECTION_COUNT; ++k) { table[d][k] = static_cast<Direction>((d + k) % DIRECTION_COUNT); }
+    }
+    return table;
+}();
+
+// Opposite of each direction, indexed by dirIndex
+inline constexpr std::array<Direction, DIRECTION_COUNT> oppositeDirections = {
+    Direction::D, Direction::DL, Direction::L, Direction::UL, Direction::U, Direction::UR, Direction::R, Direction::DR
 };
 
+constexpr pair<int, int> directionOffset(const Direction dir) { return directionOffsets[dirIndex(dir)]; }
+constexpr Direction oppositeDirection(const Direction dir) { return oppositeDirections[dirIndex(dir)]; }
+constexpr bool areOppositeDirections(const Direction d1, const Direction d2) { return oppositeDirection(d1) == d2; }
+
+// Rotate by steps * 45 degrees - positive steps turn right (clockwise), negative steps turn left
+constexpr Direction rotateDirection(const Direction dir, const int steps) {
+    return directionRotations[dirIndex(dir)][((steps % DIRECTION_COUNT) + DIRECTION_COUNT) % DIRECTION_COUNT];
+}
+
 } // namespace UserCommon_209277367_322542887
 
 // Based on the following grid system:
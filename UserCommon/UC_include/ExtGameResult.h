@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using std::array, std::size_t;
+
+namespace UserCommon_209277367_322542887 {
+
+// What a game reports beyond the staff GameResult. A game manager that fills one implements
+// ExtGameResultSource; the simulator finds it with dynamic_cast after run() and aggregates it.
+struct ExtGameResult {
+    // Phases of the GameManager turn loop. Time spent in a nested phase (battle info requested
+    // while performing the actions) is charged to the nested phase only.
+    enum Phase { GET_ACTIONS, BATTLE_INFO, TANK_ACTIONS, SHELLS, LOGGING, STATUS, PHASE_COUNT };
+
+    static constexpr array<const char*, PHASE_COUNT> phaseNames = {
+        "get_actions", "battle_info", "tank_actions", "shells", "logging", "status"
+    };
+
+    bool timed = false; // Whether phaseNanoseconds was measured (the GM was built with profiling)
+    array<uint64_t, PHASE_COUNT> phaseNanoseconds{};
+
+    // Tank algorithm time budgets, per player (index 0 = player 1)
+    bool budgeted = false; // Whether the members below were measured (a budget was set)
+    array<uint64_t, 2> actionCpuNanoseconds{}; // CPU time spent in getAction()
+    array<size_t, 2> actionOverruns{}; // getAction() calls over the per-call budget, played as DoNothing
+    array<size_t, 2> timedOutCalls{}; // getAction() calls abandoned after the time limit
+    array<bool, 2> forfeited{}; // Over the per-game budget, or a call timed out - the game ended that turn
+
+    uint64_t totalNanoseconds() const {
+        uint64_t total = 0;
+        for (const uint64_t ns : phaseNanoseconds) { total += ns; }
+        return total;
+    }
+};
+
+// Implemented by game managers that report an ExtGameResult for their last game
+class ExtGameResultSource {
+    public:
+        // Rule of 5
+        ExtGameResultSource() = default;
+        ExtGameResultSource(const ExtGameResultSource&) = default;
+        ExtGameResultSource& operator=(const ExtGameResultSource&) = default;
+        ExtGameResultSource(ExtGameResultSource&&) noexcept = default;
+        ExtGameResultSource& operator=(ExtGameResultSource&&) noexcept = default;
+        virtual ~ExtGameResultSource() = default;
+
+        virtual const ExtGameResult& getExtGameResult() const = 0; // Valid after run() returns
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -1,20 +1,23 @@
 #pragma once
 
 # include "../../common/SatelliteView.h"
+# include "Gameboard.h"
+# include "BoardExporter.h"
 # include <vector>
 
 using std::vector;
 
 namespace UserCommon_209277367_322542887 {
 
-class ExtSatelliteView final : public SatelliteView {
+class ExtSatelliteView final : public SatelliteView, public BoardExporter {
     size_t width_;
     size_t height_;
-    vector<vector<char>> map_;
+    Gameboard map_;
 
     public:
         // Rule of 5
-        ExtSatelliteView(size_t width, size_t height, vector<vector<char>> map);
+        ExtSatelliteView(size_t width, size_t height, const vector<vector<char>>& map);
+        explicit ExtSatelliteView(Gameboard map);
         ~ExtSatelliteView() override = default; // Default destructor
         ExtSatelliteView(const ExtSatelliteView&) = delete;
         ExtSatelliteView& operator=(const ExtSatelliteView&) = delete;
@@ -23,6 +26,12 @@ class ExtSatelliteView final : public SatelliteView {
 
         // API function to get an object at a specific location
         char getObjectAt(size_t x, size_t y) const override;
+
+        // The whole board, for code built with this header (the GameManager and its tests)
+        const Gameboard& getBoard() const { return map_; }
+
+        // Bulk copy for readers in other modules, see BoardExporter
+        bool exportRows(size_t width, size_t height, vector<vector<char>>& rows) const override;
 };
 
 } // namespace UserCommon_209277367_322542887
\ No newline at end of file
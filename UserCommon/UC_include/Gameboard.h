@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+using std::vector, std::size_t;
+
+namespace UserCommon_209277367_322542887 {
+
+// Contiguous row-major game board - cell (x, y) is stored at index y * width + x
+class Gameboard {
+    int width_;
+    int height_;
+    vector<char> cells_;
+
+    public:
+        // Rule of 5
+        Gameboard(); // Empty board
+        Gameboard(int width, int height, char fill = ' '); // Constructor
+        Gameboard(const Gameboard&) = default;
+        Gameboard& operator=(const Gameboard&) = default;
+        Gameboard(Gameboard&&) noexcept = default;
+        Gameboard& operator=(Gameboard&&) noexcept = default;
+        ~Gameboard() = default;
+
+        void assign(int width, int height, char fill = ' '); // Resize and fill the whole board
+
+        // Accessors are defined inline - they sit in the innermost loops of the engine
+        int getWidth() const { return width_; }
+        int getHeight() const { return height_; }
+        size_t size() const { return cells_.size(); }
+        bool empty() const { return cells_.empty(); }
+
+        // Flat index of (x, y), no wrapping
+        size_t index(const int x, const int y) const { return static_cast<size_t>(y) * width_ + x; }
+
+        char& at(const int x, const int y) { return cells_[index(x, y)]; }
+        char at(const int x, const int y) const { return cells_[index(x, y)]; }
+        char& operator[](const size_t idx) { return cells_[idx]; }
+        char operator[](const size_t idx) const { return cells_[idx]; }
+
+        // Wrap coordinates around the board edges (any offset, including negative ones)
+        int wrapX(const int x) const { return ((x % width_) + width_) % width_; }
+        int wrapY(const int y) const { return ((y % height_) + height_) % height_; }
+        char& atWrapped(const int x, const int y) { return at(wrapX(x), wrapY(y)); }
+        char atWrapped(const int x, const int y) const { return at(wrapX(x), wrapY(y)); }
+
+        // Raw access to a whole row / the whole board
+        const char* row(const int y) const { return cells_.data() + index(0, y); }
+        const char* data() const { return cells_.data(); }
+
+        bool operator==(const Gameboard& other) const;
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Direction.h"
+
+using std::vector, std::shared_ptr, std::size_t;
+
+namespace UserCommon_209277367_322542887 {
+
+// Precomputed wrap-around neighbors of every cell of a board - cell (x, y) has id y * width + x.
+// Tables are immutable once built, so one table can be shared by all the games on boards of the
+// same size (see forBoard). The cache is per module: the GameManager and Algorithm .so files each
+// bundle their own copy of UserCommon, so each builds its own tables.
+class NeighborTable {
+    int width_;
+    int height_;
+    vector<int> neighbors_; // [cell * DIRECTION_COUNT + dirIndex] -> neighbor cell id
+    vector<int> cellX_; // Per cell: x-coordinate
+    vector<int> cellY_; // Per cell: y-coordinate
+
+    public:
+        // Rule of 5
+        NeighborTable(); // Empty table
+        NeighborTable(int width, int height); // Constructor
+        NeighborTable(const NeighborTable&) = default;
+        NeighborTable& operator=(const NeighborTable&) = default;
+        NeighborTable(NeighborTable&&) noexcept = default;
+        NeighborTable& operator=(NeighborTable&&) noexcept = default;
+        ~NeighborTable() = default;
+
+        // Shared table for a width x height board, built on first use (thread-safe)
+        static shared_ptr<const NeighborTable> forBoard(int width, int height);
+
+        // Accessors are defined inline - they sit in the innermost loops of the engine and the pathfinder
+        int getWidth() const { return width_; }
+        int getHeight() const { return height_; }
+        int cellCount() const { return width_ * height_; }
+
+        int cellOf(const int x, const int y) const { return y * width_ + x; }
+        int xOf(const int cell) const { return cellX_[cell]; }
+        int yOf(const int cell) const { return cellY_[cell]; }
+
+        // Cell one step from cell in direction dir, wrapping around the board edges
+        int next(const int cell, const Direction dir) const { return neighbors_[cell * DIRECTION_COUNT + dirIndex(dir)]; }
+        pair<int, int> next(const int x, const int y, const Direction dir) const {
+            const int cell = next(cellOf(x, y), dir);
+            return {cellX_[cell], cellY_[cell]};
+        }
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,30 @@
+#pragma once
+
+# include "../../common/SatelliteView.h"
+# include "Gameboard.h"
+
+namespace UserCommon_209277367_322542887 {
+
+// Read-only view of a board that shows one cell as a different symbol (e.g. the requesting
+// tank as '%'). It only references the board - nothing is copied or allocated, so the board
+// must outlive the view and must not change while the view is in use.
+class OverlaySatelliteView : public SatelliteView {
+    const Gameboard& map_;
+    size_t overlayX_;
+    size_t overlayY_;
+    char overlay_;
+
+    public:
+        // Rule of 5
+        OverlaySatelliteView(const Gameboard& map, size_t overlay_x, size_t overlay_y, char overlay);
+        ~OverlaySatelliteView() override = default; // Default destructor
+        OverlaySatelliteView(const OverlaySatelliteView&) = delete;
+        OverlaySatelliteView& operator=(const OverlaySatelliteView&) = delete;
+        OverlaySatelliteView(OverlaySatelliteView&&) noexcept = delete;
+        OverlaySatelliteView& operator=(OverlaySatelliteView&&) noexcept = delete;
+
+        // API function to get an object at a specific location
+        char getObjectAt(size_t x, size_t y) const override;
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,23 @@
+#pragma once
+
+namespace UserCommon_209277367_322542887 {
+
+// Implemented by game managers that can play any number of games in a row. The simulator
+// keeps one per worker thread and calls reset() after every game instead of destroying it,
+// so the next game reuses its buffers.
+class ReusableGameManager {
+    public:
+        // Rule of 5
+        ReusableGameManager() = default;
+        ReusableGameManager(const ReusableGameManager&) = default;
+        ReusableGameManager& operator=(const ReusableGameManager&) = default;
+        ReusableGameManager(ReusableGameManager&&) noexcept = default;
+        ReusableGameManager& operator=(ReusableGameManager&&) noexcept = default;
+        virtual ~ReusableGameManager() = default;
+
+        // Release everything tied to the last game - players, tank algorithms and their
+        // factories may be destroyed (and their libraries unloaded) right after this returns
+        virtual void reset() = 0;
+};
+
+} // namespace UserCommon_209277367_322542887
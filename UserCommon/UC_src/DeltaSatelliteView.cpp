@@ -0,0 +1,10 @@
+# include "DeltaSatelliteView.h"
+
+namespace UserCommon_209277367_322542887 {
+
+// Constructor - an overlay view plus the changes since the player's previous view
+DeltaSatelliteView::DeltaSatelliteView(const Gameboard& map, const size_t overlay_x, const size_t overlay_y,
+    const char overlay, const vector<size_t>* changed_cells)
+    : OverlaySatelliteView(map, overlay_x, overlay_y, overlay), width_(map.getWidth()), changedCells_(changed_cells) {}
+
+} // namespace UserCommon_209277367_322542887
@@ -4,17 +4,39 @@
 
 namespace UserCommon_209277367_322542887 {
 
-// Constructor
-ExtSatelliteView::ExtSatelliteView(const size_t width, const size_t height, vector<vector<char>> map)
-    : width_(width), height_(height), map_(std::move(map)) {}
+// Constructor - flattens a 2D grid into a contiguous board
+ExtSatelliteView::ExtSatelliteView(const size_t width, const size_t height, const vector<vector<char>>& map)
+    : width_(width), height_(height), map_(static_cast<int>(width), static_cast<int>(height)) {
+    for (size_t y = 0; y < height_ && y < map.size(); ++y) {
+        for (size_t x = 0; x < width_ && x < map[y].size(); ++x) {
+            map_.at(static_cast<int>(x), static_cast<int>(y)) = map[y][x];
+        }
+    }
+}
+
+// Constructor - takes ownership of an already flat board
+ExtSatelliteView::ExtSatelliteView(Gameboard map)
+    : width_(map.getWidth()), height_(map.getHeight()), map_(std::move(map)) {}
 
 // Function to retrieve an object at a given location
 char ExtSatelliteView::getObjectAt(const size_t x, const size_t y) const {
     if (x < width_ && y < height_) {
-        return map_[y][x];
+        return map_.at(static_cast<int>(x), static_cast<int>(y));
     }
 
     return '&'; // Return a space character if out of bounds
 }
 
+// Function to copy the whole board out, a row at a time
+bool ExtSatelliteView::exportRows(const size_t width, const size_t height, vector<vector<char>>& rows) const {
+    if (width != width_ || height != height_) { return false; }
+
+    rows.resize(height_);
+    for (size_t y = 0; y < height_; ++y) {
+        const char* row = map_.row(static_cast<int>(y));
+        rows[y].assign(row, row + width_);
+    }
+    return true;
+}
+
 } // namespace UserCommon_209277367_322542887
\ No newline at end of file
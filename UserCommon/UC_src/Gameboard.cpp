@@ -0,0 +1,23 @@
+#include "Gameboard.h"
+
+namespace UserCommon_209277367_322542887 {
+
+// Constructors
+Gameboard::Gameboard() : width_(0), height_(0) {}
+
+Gameboard::Gameboard(const int width, const int height, const char fill)
+    : width_(width), height_(height), cells_(static_cast<size_t>(width) * height, fill) {}
+
+// Resize the board and fill every cell, reusing the existing allocation when possible
+void Gameboard::assign(const int width, const int height, const char fill) {
+    width_ = width;
+    height_ = height;
+    cells_.assign(static_cast<size_t>(width) * height, fill);
+}
+
+// Boards are equal if they have the same dimensions and cells
+bool Gameboard::operator==(const Gameboard& other) const {
+    return width_ == other.width_ && height_ == other.height_ && cells_ == other.cells_;
+}
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,45 @@
+#include "NeighborTable.h"
+
+#include <map>
+#include <mutex>
+
+namespace UserCommon_209277367_322542887 {
+
+// Constructors
+NeighborTable::NeighborTable() : width_(0), height_(0) {}
+
+NeighborTable::NeighborTable(const int width, const int height) : width_(width), height_(height) {
+    const int cells = width * height;
+    neighbors_.resize(static_cast<size_t>(cells) * DIRECTION_COUNT);
+    cellX_.resize(cells);
+    cellY_.resize(cells);
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const int cell = cellOf(x, y);
+            cellX_[cell] = x;
+            cellY_[cell] = y;
+            for (int d = 0; d < DIRECTION_COUNT; ++d) {
+                auto [dx, dy] = directionOffsets[d];
+                neighbors_[cell * DIRECTION_COUNT + d] = cellOf((x + dx + width) % width, (y + dy + height) % height);
+            }
+        }
+    }
+}
+
+// Tables are cached per board size and kept alive while someone still holds them
+shared_ptr<const NeighborTable> NeighborTable::forBoard(const int width, const int height) {
+    static std::mutex cache_mutex;
+    static std::map<pair<int, int>, std::weak_ptr<const NeighborTable>> cache;
+
+    std::lock_guard lock(cache_mutex);
+    auto& entry = cache[{width, height}];
+    auto table = entry.lock();
+    if (!table) {
+        table = std::make_shared<const NeighborTable>(width, height);
+        entry = table;
+    }
+    return table;
+}
+
+} // namespace UserCommon_209277367_322542887
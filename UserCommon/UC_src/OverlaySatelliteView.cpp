@@ -0,0 +1,19 @@
+# include "OverlaySatelliteView.h"
+
+namespace UserCommon_209277367_322542887 {
+
+// Constructor - references the board and remembers the overlaid cell
+OverlaySatelliteView::OverlaySatelliteView(const Gameboard& map, const size_t overlay_x, const size_t overlay_y, const char overlay)
+    : map_(map), overlayX_(overlay_x), overlayY_(overlay_y), overlay_(overlay) {}
+
+// Function to retrieve an object at a given location
+char OverlaySatelliteView::getObjectAt(const size_t x, const size_t y) const {
+    if (x < static_cast<size_t>(map_.getWidth()) && y < static_cast<size_t>(map_.getHeight())) {
+        if (x == overlayX_ && y == overlayY_) { return overlay_; }
+        return map_.at(static_cast<int>(x), static_cast<int>(y));
+    }
+
+    return '&'; // Out of bounds, as in ExtSatelliteView
+}
+
+} // namespace UserCommon_209277367_322542887
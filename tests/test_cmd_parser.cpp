@@ -263,6 +263,46 @@ TEST(CmdParserTest, NumThreadsRejectsZeroNegativeAndJunk) {
     EXPECT_FALSE(rj.valid);
 }
 
+// ---------------- Time budget Validation ----------------
+
+TEST(CmdParserTest, TimeBudgetsParsedAndDefaultToNone) {
+    TempDir t;
+    const fs::path mapsDir = t.path() / "maps";
+    const fs::path gmSo    = t.path() / "gm.so";
+    const fs::path algos   = t.path() / "algos";
+    fs::create_directories(mapsDir);
+    touch(mapsDir / "m1.map", "x");
+    fs::create_directories(algos);
+    touch(algos / "a1.so", "");
+    touch(gmSo, "");
+
+    Argv a({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        "action_budget_us=500", "action_timeout_ms=2000"
+    });
+
+    auto result = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_TRUE(result.valid) << result.errorMessage;
+    EXPECT_EQ(result.actionBudgetUs, 500u);
+    EXPECT_EQ(result.gameBudgetMs, 0u); // Not given - no budget
+    EXPECT_EQ(result.actionTimeoutMs, 2000u);
+}
+
+TEST(CmdParserTest, TimeBudgetsRejectNegativeAndJunk) {
+    Argv an({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm", "game_budget_ms=-5"});
+    auto rn = CmdParser::parse(an.argc(), an.argv());
+    EXPECT_FALSE(rn.valid);
+    EXPECT_NE(rn.errorMessage.find("Invalid value for game_budget_ms"), std::string::npos);
+
+    Argv aj({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm", "action_timeout_ms=1s"});
+    auto rj = CmdParser::parse(aj.argc(), aj.argv());
+    EXPECT_FALSE(rj.valid);
+    EXPECT_NE(rj.errorMessage.find("Invalid value for action_timeout_ms"), std::string::npos);
+}
+
 // ---------------- Filesystem Validation ----------------
 
 TEST(CmdParserTest, FailsOnMissingOrInvalidPaths) {
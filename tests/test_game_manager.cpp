@@ -0,0 +1,1055 @@
+// tests/test_game_manager.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "./utils/gm_utils.test.cpp"
+
+using GameManager_209277367_322542887::GameLogWriter;
+using GameManager_209277367_322542887::GameState;
+using GameManager_209277367_322542887::ShellPool;
+using GameManager_209277367_322542887::TankTable;
+using UserCommon_209277367_322542887::BoardExporter;
+using UserCommon_209277367_322542887::DeltaSatelliteView;
+using UserCommon_209277367_322542887::Direction;
+using UserCommon_209277367_322542887::NeighborTable;
+using UserCommon_209277367_322542887::OverlaySatelliteView;
+
+// Board and state hash after one turn
+using TurnState = std::pair<std::vector<std::string>, uint64_t>;
+
+// A GM setup under test, e.g. a shell backend
+using GMSetup = std::pair<std::string, std::function<void(GM_209277367_322542887&)>>;
+
+// Runs a test in a temporary working directory, where the GMs write their verbose logs
+class InTempDir {
+    TempDir dir_;
+    fs::path cwd_;
+
+public:
+    InTempDir() : cwd_(fs::current_path()) { fs::current_path(dir_.path()); }
+    InTempDir(const InTempDir&) = delete;
+    InTempDir& operator=(const InTempDir&) = delete;
+    ~InTempDir() { fs::current_path(cwd_); }
+};
+
+// ---------- Fixture ----------
+class GameManagerTest : public ::testing::Test {
+protected:
+    static TurnState stateOf(const GM_209277367_322542887& gm) {
+        return {rowsOf(gm.getGameboard()), gm.getStateHash()};
+    }
+
+    // Plays the rest of a started game, returning the state after every turn
+    static std::vector<TurnState> playToEnd(GM_209277367_322542887& gm) {
+        std::vector<TurnState> turns;
+        while (gm.playTurn()) turns.push_back(stateOf(gm));
+        turns.push_back(stateOf(gm));
+        return turns;
+    }
+
+    // Plays the scripted games on a GM of every setup, checking turn by turn that each one
+    // matches the first setup (the reference)
+    static void expectSameTurns(const std::vector<GMSetup>& setups) {
+        for (const auto& map : testMaps()) {
+            for (uint32_t seed = 1; seed <= 4; ++seed) {
+                SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+                std::vector<std::unique_ptr<GM_209277367_322542887>> gms;
+                std::vector<std::unique_ptr<ScriptedGame>> games;
+                for (const auto& setup : setups) {
+                    auto& gm = gms.emplace_back(std::make_unique<GM_209277367_322542887>(false));
+                    setup.second(*gm);
+                    games.emplace_back(std::make_unique<ScriptedGame>(seed))->start(*gm, map);
+                }
+
+                bool running = true;
+                while (running) {
+                    running = gms[0]->playTurn();
+                    const TurnState expected = stateOf(*gms[0]);
+                    ASSERT_EQ(expected.second, gms[0]->computeStateHash());
+                    for (size_t i = 1; i < gms.size(); ++i) {
+                        SCOPED_TRACE(setups[i].first + " turn " + std::to_string(gms[0]->getTurn()));
+                        ASSERT_EQ(gms[i]->playTurn(), running);
+                        ASSERT_EQ(stateOf(*gms[i]), expected);
+                        ASSERT_EQ(gms[i]->getStateHash(), gms[i]->computeStateHash());
+                    }
+                }
+                const GameResult expected = gms[0]->finishGame();
+                for (size_t i = 1; i < gms.size(); ++i) expectSameResult(gms[i]->finishGame(), expected);
+            }
+        }
+    }
+
+    // Verbose log of the last game on map between the named players, from the working directory
+    static std::string readLog(const TestMap& map, const std::string& name1 = "scripted1",
+                               const std::string& name2 = "scripted2") {
+        std::ifstream in("output_" + map.name + "_GM_209277367_322542887_" + name1 + "_" + name2);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+};
+
+// ===================== Board storage =====================
+
+TEST_F(GameManagerTest, Gameboard_IndexesRowMajorAndWraps) {
+    Gameboard board(5, 3, '.');
+    EXPECT_EQ(board.size(), 15u);
+    board.at(4, 1) = 'x';
+    EXPECT_EQ(board.index(4, 1), 9u);
+    EXPECT_EQ(board[9], 'x');
+    EXPECT_EQ(board.row(1)[4], 'x');
+    EXPECT_EQ(board.atWrapped(-1, 4), 'x');
+    EXPECT_EQ(board.atWrapped(9, -2), 'x');
+    EXPECT_EQ(rowsOf(board), (std::vector<std::string>{".....", "....x", "....."}));
+}
+
+// Games of the original GameManager, before its board, shell and tank storage was rewritten: the
+// result, and FNV-1a hashes of the final board, the battle info views of each player and the log
+struct GoldenGame {
+    const char* map;
+    uint32_t seed;
+    int winner;
+    int reason;
+    size_t rounds;
+    std::vector<size_t> remainingTanks;
+    uint64_t board;
+    uint64_t views1;
+    uint64_t views2;
+    uint64_t log;
+};
+
+static const std::vector<GoldenGame> goldenGames = {
+    {"maze", 1, 1, 0, 130, {1, 0}, 0xb5160cfee7cf3e74ull, 0x2667a94141eda73dull, 0x912ac9c32b5d8a69ull, 0x22167f4bf9b798f8ull},
+    {"maze", 2, 0, 0, 174, {0, 0}, 0x9cc23c5e15451045ull, 0x46e8e0e10d389978ull, 0x63826c772f472c7bull, 0xa635d14613f5149cull},
+    {"maze", 3, 1, 0, 226, {1, 0}, 0x1c0cb53dfcf4cf9bull, 0x72aa11d0ef7c3591ull, 0xa477be5d508f86b3ull, 0x2cab3569a581dc4bull},
+    {"maze", 4, 2, 0, 180, {0, 1}, 0x8726ae4dc6609ba6ull, 0xb73c2d51c27877f2ull, 0x8286a1e14525ab6full, 0xf3565fe502ab39f0ull},
+    {"open", 1, 1, 0, 12, {2, 0}, 0x2257fa247e358323ull, 0xcccfdf633f4af6dfull, 0x846cf4d86a05d929ull, 0xcd01f96b9744ec5aull},
+    {"open", 2, 0, 0, 53, {0, 0}, 0xaa6d309f9ccfa197ull, 0x0556a0b46a81f3e3ull, 0x69b3cf6edde72a16ull, 0xdfd21c7060a7d8d6ull},
+    {"open", 3, 2, 0, 20, {0, 3}, 0xb7b9fea3878de65full, 0x462d9115b319848bull, 0xb179aed69f16b2bfull, 0x465a95e7915fb965ull},
+    {"open", 4, 1, 0, 25, {1, 0}, 0xea18fbdecacc2586ull, 0xf445a77834ad71e2ull, 0x76b5006c658e5697ull, 0x004f255312364f6full},
+    {"arena", 1, 1, 0, 31, {4, 0}, 0x94344866f40f90fdull, 0xcf7f42621552ee1bull, 0x89cf8320c793080cull, 0xc6ad2732ee2eb33cull},
+    {"arena", 2, 2, 0, 253, {0, 1}, 0x0a18466797695c42ull, 0x22be81ca43e0d9abull, 0xa9593bcb452ee01eull, 0xfef8359c488a58a3ull},
+    {"arena", 3, 2, 0, 68, {0, 3}, 0x30b0767d46846703ull, 0x70aa0b8404d60e99ull, 0x1e1226025a227ae8ull, 0x7e88fb08699d74d7ull},
+    {"arena", 4, 1, 0, 73, {1, 0}, 0x81437520951bd3d7ull, 0x8a8b9e27ead39e27ull, 0x0ba59be55d187175ull, 0x04dbb4607c2acfa6ull},
+};
+
+TEST_F(GameManagerTest, GoldenGames_MatchTheOriginalGameManager) {
+    InTempDir in_temp_dir;
+    for (const auto& golden : goldenGames) {
+        const TestMap& map = *std::find_if(testMaps().begin(), testMaps().end(),
+            [&](const TestMap& m) { return m.name == golden.map; });
+        SCOPED_TRACE(map.name + " seed " + std::to_string(golden.seed));
+        ScriptedGame game(golden.seed);
+        GameResult result;
+        {
+            GM_209277367_322542887 gm(true);
+            result = game.run(gm, map);
+        } // Destroying the GM writes out its log
+
+        EXPECT_EQ(result.winner, golden.winner);
+        EXPECT_EQ(static_cast<int>(result.reason), golden.reason);
+        EXPECT_EQ(result.rounds, golden.rounds);
+        EXPECT_EQ(result.remaining_tanks, golden.remainingTanks);
+        std::string board;
+        for (const auto& row : rowsOf(result)) board += row;
+        EXPECT_EQ(fnv1a(board), golden.board);
+        EXPECT_EQ(game.player1.views, golden.views1);
+        EXPECT_EQ(game.player2.views, golden.views2);
+        EXPECT_EQ(fnv1a(readLog(map)), golden.log);
+    }
+}
+
+// ===================== Start-of-turn snapshot =====================
+
+// A battle info shows the board as it was when the turn started, with the requesting tank as '%',
+// whatever the tanks acting before it in the same turn did
+TEST_F(GameManagerTest, Snapshot_BattleInfoShowsTheStartOfTheTurn) {
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            std::vector<std::string> turn_start;
+            TurnWatch watch{&gm, [&] { turn_start = rowsOf(gm.gameboard_); }};
+            game.watch = &watch;
+
+            const auto check = [&](SatelliteView& view) {
+                std::vector<std::string> seen = turn_start;
+                size_t overlays = 0;
+                for (size_t y = 0; y < map.height(); ++y) {
+                    for (size_t x = 0; x < map.width(); ++x) {
+                        const char object = view.getObjectAt(x, y);
+                        if (object != '%') { seen[y][x] = object; continue; }
+                        ++overlays;
+                        EXPECT_TRUE(turn_start[y][x] == '1' || turn_start[y][x] == '2') << "'%' on " << turn_start[y][x];
+                    }
+                }
+                EXPECT_EQ(overlays, 1u);
+                EXPECT_EQ(seen, turn_start) << "turn " << gm.turn_;
+            };
+            game.player1.check = check;
+            game.player2.check = check;
+            game.run(gm, map);
+            EXPECT_GT(game.player1.count + game.player2.count, 0u);
+        }
+    }
+}
+
+// ===================== Shell and tank grids =====================
+
+// Between turns every cell of the shell grid holds the lowest live shell slot located there
+TEST_F(GameManagerTest, ShellGrid_HoldsTheLowestShellOfEveryCell) {
+    size_t shells_seen = 0;
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            TurnWatch watch{&gm, [&] {
+                std::vector<int> lowest(gm.gameboard_.size(), -1);
+                for (int slot = gm.shells_.slots() - 1; slot >= 0; --slot) {
+                    if (!gm.shells_.isAlive(slot)) continue;
+                    lowest[gm.gameboard_.index(gm.shells_.getX(slot), gm.shells_.getY(slot))] = slot;
+                    ++shells_seen;
+                }
+                for (size_t cell = 0; cell < lowest.size(); ++cell) {
+                    ASSERT_EQ(gm.shellGrid_.at(cell), lowest[cell]) << "cell " << cell << " turn " << gm.turn_;
+                }
+            }};
+            game.watch = &watch;
+            game.run(gm, map);
+        }
+    }
+    EXPECT_GT(shells_seen, 0u);
+}
+
+// Between turns every cell of the tank grid holds the lowest alive tank located there
+TEST_F(GameManagerTest, TankGrid_HoldsTheLowestAliveTankOfEveryCell) {
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            TurnWatch watch{&gm, [&] {
+                std::vector<int> lowest(gm.gameboard_.size(), -1);
+                for (int index = gm.tanks_.size() - 1; index >= 0; --index) {
+                    if (gm.tanks_.getIsAlive(index) != 0) continue;
+                    const auto [x, y] = gm.tanks_.getLocation(index);
+                    lowest[gm.gameboard_.index(x, y)] = index;
+                }
+                for (size_t cell = 0; cell < lowest.size(); ++cell) {
+                    ASSERT_EQ(gm.tankGrid_.at(cell), lowest[cell]) << "cell " << cell << " turn " << gm.turn_;
+                }
+            }};
+            game.watch = &watch;
+            game.run(gm, map);
+        }
+    }
+}
+
+// ===================== Shell pool =====================
+
+TEST_F(GameManagerTest, ShellPool_KeepsSlotsUntilCompacted) {
+    ShellPool pool;
+    pool.reset(4);
+    const int first = pool.spawn(1, 2, Direction::U);
+    const int second = pool.spawn(3, 4, Direction::R);
+    const int third = pool.spawn(5, 6, Direction::DL);
+    pool.setAboveMine(third, true);
+
+    pool.kill(second);
+    EXPECT_EQ(pool.slots(), 3); // Tombstoned, not removed
+    EXPECT_EQ(pool.liveCount(), 2);
+    EXPECT_FALSE(pool.isAlive(second));
+    EXPECT_EQ(pool.nextAlive(second), third);
+    EXPECT_EQ(pool.getX(third), 5);
+
+    pool.compact({third, first});
+    EXPECT_EQ(pool.slots(), 2);
+    EXPECT_EQ(pool.liveCount(), 2);
+    EXPECT_EQ(pool.getX(0), 5);
+    EXPECT_EQ(pool.getY(0), 6);
+    EXPECT_EQ(pool.getDirection(0), Direction::DL);
+    EXPECT_TRUE(pool.isAboveMine(0));
+    EXPECT_EQ(pool.getX(1), 1);
+    EXPECT_EQ(pool.getDirection(1), Direction::U);
+    EXPECT_FALSE(pool.isAboveMine(1));
+
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.slots(), 0);
+}
+
+// ===================== Shell collisions =====================
+
+// Two shells fired at each other meet in the middle cell and destroy each other, missing both tanks
+TEST_F(GameManagerTest, ShellCollisions_ShellsMeetingInACellDestroyEachOther) {
+    const TestMap map = {"corridor", {
+        "###########",
+        "#2       1#",
+        "###########"}, 10, 1};
+    GM_209277367_322542887 gm(false);
+    ScriptedGame game(std::vector<ActionRequest>{ActionRequest::Shoot, ActionRequest::DoNothing});
+    std::vector<int> shells;
+    TurnWatch watch{&gm, [&] { shells.push_back(gm.shells_.liveCount()); }};
+    game.watch = &watch;
+    game.run(gm, map);
+
+    ASSERT_EQ(shells.size(), map.maxSteps);
+    EXPECT_EQ(shells[1], 2); // Both fired on the first turn, two steps each per turn
+    EXPECT_EQ(shells[2], 0); // Both gone on the second turn
+    EXPECT_EQ(rowsOf(gm.gameboard_), map.rows); // Both tanks still there, at max steps
+}
+
+// ===================== Tank counters =====================
+
+// Between turns the per-player counters and the destroyed flags agree with a recount of the tanks
+TEST_F(GameManagerTest, TankCounters_MatchARecountEveryTurn) {
+    size_t destroyed = 0;
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            const auto recount = [&] {
+                std::array<size_t, 2> alive{}, out_of_ammo{};
+                for (int index = 0; index < gm.tanks_.size(); ++index) {
+                    const bool is_alive = gm.tanks_.getIsAlive(index) == 0;
+                    EXPECT_EQ(gm.tanks_.isDestroyed(index), !is_alive) << "tank " << index;
+                    if (!is_alive) continue;
+                    ++alive[gm.tanks_.getPlayerId(index) - 1];
+                    if (gm.tanks_.getAmmo(index) == 0) ++out_of_ammo[gm.tanks_.getPlayerId(index) - 1];
+                }
+                EXPECT_EQ(gm.aliveTanks_, alive) << "turn " << gm.turn_;
+                EXPECT_EQ(gm.outOfAmmoTanks_, out_of_ammo) << "turn " << gm.turn_;
+            };
+            TurnWatch watch{&gm, recount};
+            game.watch = &watch;
+            game.run(gm, map);
+            for (int index = 0; index < gm.tanks_.size(); ++index) destroyed += gm.tanks_.isDestroyed(index);
+        }
+    }
+    EXPECT_GT(destroyed, 0u);
+}
+
+// ===================== Neighbor tables =====================
+
+TEST_F(GameManagerTest, NeighborTable_MatchesWrappedOffsets) {
+    const Gameboard board(7, 5);
+    const auto table = NeighborTable::forBoard(7, 5);
+    EXPECT_EQ(table, NeighborTable::forBoard(7, 5)); // Shared by boards of the same size
+    EXPECT_NE(table, NeighborTable::forBoard(5, 7));
+
+    for (int y = 0; y < 5; ++y) {
+        for (int x = 0; x < 7; ++x) {
+            EXPECT_EQ(table->xOf(table->cellOf(x, y)), x);
+            EXPECT_EQ(table->yOf(table->cellOf(x, y)), y);
+            for (int d = 0; d < DIRECTION_COUNT; ++d) {
+                const auto dir = static_cast<Direction>(d);
+                const auto [dx, dy] = directionOffset(dir);
+                const std::pair<int, int> expected = {board.wrapX(x + dx), board.wrapY(y + dy)};
+                EXPECT_EQ(table->next(x, y, dir), expected) << x << "," << y << " dir " << d;
+                EXPECT_EQ(table->next(table->cellOf(x, y), dir), table->cellOf(expected.first, expected.second));
+            }
+        }
+    }
+
+    for (int d = 0; d < DIRECTION_COUNT; ++d) {
+        const auto dir = static_cast<Direction>(d);
+        EXPECT_EQ(rotateDirection(dir, 4), oppositeDirection(dir));
+        EXPECT_EQ(rotateDirection(dir, -1), rotateDirection(dir, 7));
+        EXPECT_TRUE(areOppositeDirections(dir, oppositeDirection(dir)));
+    }
+}
+
+// ===================== Background log writer =====================
+
+// Logs submitted from several threads at once are all on disk, in full, after flush()
+TEST_F(GameManagerTest, GameLogWriter_WritesEverySubmittedLog) {
+    TempDir dir;
+    const int threads = 4, logs_per_thread = 25;
+    const auto contents = [](int log) { return std::string(997 * log + 1, static_cast<char>('a' + log % 26)); };
+    const auto path = [&](int log) { return dir.path() / ("log" + std::to_string(log)); };
+
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < threads; ++t) {
+        submitters.emplace_back([&, t] {
+            for (int i = 0; i < logs_per_thread; ++i) {
+                const int log = t * logs_per_thread + i;
+                GameLogWriter::get().submit(std::ofstream(path(log)), contents(log));
+            }
+        });
+    }
+    for (auto& submitter : submitters) submitter.join();
+    GameLogWriter::get().flush();
+
+    for (int log = 0; log < threads * logs_per_thread; ++log) {
+        std::ifstream in(path(log));
+        EXPECT_EQ(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()), contents(log))
+            << "log " << log;
+    }
+}
+
+// ===================== Replay recording =====================
+
+// A recording holds the header, the map and every tank's action of every turn: its script while
+// it is alive (escaped when the action was ignored), then ACTION_NONE
+TEST_F(GameManagerTest, ReplayRecorder_RecordsTheMapAndEveryAction) {
+    namespace Format = GameManager_209277367_322542887::ReplayFormat;
+    using GameManager_209277367_322542887::NibbleReader;
+    TempDir dir;
+    for (const auto& map : testMaps()) {
+        SCOPED_TRACE(map.name);
+        const fs::path file = dir.path() / (map.name + ".tkr");
+        ScriptedGame game(1);
+        GameResult result;
+        int tanks = 0;
+        {
+            GM_209277367_322542887 gm(false);
+            gm.setReplayFile(file.string());
+            result = game.run(gm, map);
+            tanks = gm.tanks_.size();
+        } // Destroying the GM writes out the replay
+
+        std::ifstream in(file, std::ios::binary);
+        const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        size_t at = 0;
+        const auto u8 = [&] { return static_cast<uint8_t>(bytes.at(at++)); };
+        const auto u16 = [&] { const uint32_t low = u8(); return low | (u8() << 8); };
+        const auto u32 = [&] { const uint32_t low = u16(); return low | (u16() << 16); };
+        const auto text = [&] { const size_t length = u16(); at += length; return bytes.substr(at - length, length); };
+
+        ASSERT_EQ(bytes.substr(0, 4), std::string(Format::MAGIC.begin(), Format::MAGIC.end()));
+        at = 4;
+        EXPECT_EQ(u8(), Format::VERSION);
+        EXPECT_EQ(u32(), map.width());
+        EXPECT_EQ(u32(), map.height());
+        EXPECT_EQ(u32(), map.maxSteps);
+        EXPECT_EQ(u32(), map.numShells);
+        ASSERT_EQ(u32(), static_cast<uint32_t>(tanks));
+        const size_t turns = u32();
+        EXPECT_EQ(turns, result.rounds + 1); // rounds is the number of the last turn, counted from 0
+        EXPECT_EQ(text(), map.name);
+        EXPECT_EQ(text(), "scripted1");
+        EXPECT_EQ(text(), "scripted2");
+
+        const auto* data = reinterpret_cast<const uint8_t*>(bytes.data()) + at;
+        NibbleReader cells(data, bytes.size() - at);
+        std::vector<std::string> rows(map.height(), std::string(map.width(), ' '));
+        for (auto& row : rows) {
+            for (char& cell : row) cell = Format::MAP_SYMBOLS.at(cells.get()); // The test maps need no escapes
+        }
+        EXPECT_EQ(rows, map.rows);
+
+        at += cells.bytesUsed();
+        NibbleReader actions(data + cells.bytesUsed(), bytes.size() - at);
+        std::vector<bool> alive(tanks, true);
+        for (size_t turn = 0; turn < turns; ++turn) {
+            for (int tank = 0; tank < tanks; ++tank) {
+                SCOPED_TRACE("turn " + std::to_string(turn) + " tank " + std::to_string(tank));
+                uint8_t code = actions.get();
+                if (code == Format::ACTION_NONE) { alive[tank] = false; continue; }
+                ASSERT_TRUE(alive[tank]); // Dead tanks stay dead
+                if (code == Format::ESCAPE) code = actions.get();
+                EXPECT_EQ(Format::actionFromCode(code), game.scripts()[tank][turn]);
+            }
+        }
+        EXPECT_EQ(at + actions.bytesUsed(), bytes.size());
+    }
+}
+
+// ===================== saveState / restoreState =====================
+
+TEST_F(GameManagerTest, RestoreState_ReplaysTheSameTurns) {
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 3; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            game.start(gm, map);
+
+            // Save a few turns in, before the game can be over
+            const int save_turn = 5;
+            while (gm.getTurn() < save_turn && gm.playTurn()) {}
+            ASSERT_FALSE(gm.isGameOver());
+            GameState saved;
+            gm.saveState(saved);
+            const auto saved_cursors = game.cursors;
+            const TurnState at_save = stateOf(gm);
+
+            const std::vector<TurnState> first = playToEnd(gm);
+            const uint64_t first_hash = gm.getStateHash();
+            const GameResult first_result = gm.finishGame();
+
+            // Back to the saved turn, after the game was finished
+            ASSERT_TRUE(gm.restoreState(saved));
+            game.cursors = saved_cursors;
+            EXPECT_EQ(gm.getTurn(), save_turn);
+            EXPECT_FALSE(gm.isGameOver());
+            EXPECT_EQ(stateOf(gm), at_save);
+
+            const std::vector<TurnState> second = playToEnd(gm);
+            EXPECT_EQ(second, first);
+            EXPECT_EQ(gm.getStateHash(), first_hash);
+            expectSameResult(gm.finishGame(), first_result);
+        }
+    }
+}
+
+TEST_F(GameManagerTest, RestoreState_ForksMidGameAndRejectsOtherGames) {
+    const TestMap& map = testMaps().front();
+    GM_209277367_322542887 gm(false);
+    ScriptedGame game(11); // A long game
+    game.start(gm, map);
+
+    while (gm.getTurn() < 20 && gm.playTurn()) {}
+    GameState saved;
+    gm.saveState(saved);
+    const auto saved_cursors = game.cursors;
+
+    std::vector<TurnState> first;
+    while (gm.getTurn() < 60 && gm.playTurn()) first.push_back(stateOf(gm));
+    ASSERT_FALSE(gm.isGameOver());
+
+    // The same continuation from the fork point, twice
+    for (int fork = 0; fork < 2; ++fork) {
+        ASSERT_TRUE(gm.restoreState(saved));
+        game.cursors = saved_cursors;
+        std::vector<TurnState> again;
+        while (gm.getTurn() < 60 && gm.playTurn()) again.push_back(stateOf(gm));
+        EXPECT_EQ(again, first);
+    }
+
+    // A state of a game on another board does not apply
+    GM_209277367_322542887 other(false);
+    ScriptedGame other_game(1);
+    other_game.start(other, testMaps()[1]);
+    GameState other_state;
+    other.saveState(other_state);
+    EXPECT_FALSE(gm.restoreState(other_state));
+    EXPECT_EQ(stateOf(gm), first.back());
+}
+
+// ===================== Parallel callbacks =====================
+
+// With the callbacks on a TaskPool a game plays out exactly as serially: the same turns, battle
+// info views, result and log
+TEST_F(GameManagerTest, ParallelCallbacks_PlayLikeSerial) {
+    struct Played {
+        std::vector<TurnState> turns;
+        GameResult result;
+        std::pair<uint64_t, uint64_t> views;
+        std::string log;
+    };
+
+    InTempDir in_temp_dir;
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 3; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            const auto play = [&](size_t threads) {
+                Played played;
+                {
+                    GM_209277367_322542887 gm(true);
+                    gm.setCallbackThreads(threads);
+                    ScriptedGame game(seed);
+                    game.start(gm, map);
+                    played.turns = playToEnd(gm);
+                    played.result = gm.finishGame();
+                    played.views = {game.player1.views, game.player2.views};
+                } // Destroying the GM writes out its log
+                played.log = readLog(map);
+                return played;
+            };
+
+            const Played serial = play(1);
+            ASSERT_FALSE(serial.log.empty());
+            for (const size_t threads : {2, 4}) {
+                SCOPED_TRACE("callback threads " + std::to_string(threads));
+                const Played parallel = play(threads);
+                EXPECT_EQ(parallel.turns, serial.turns);
+                expectSameResult(parallel.result, serial.result);
+                EXPECT_EQ(parallel.views, serial.views);
+                EXPECT_EQ(parallel.log, serial.log);
+            }
+        }
+    }
+}
+
+// ===================== Battle info views =====================
+
+TEST_F(GameManagerTest, OverlayView_ShowsTheBoardWithOneCellReplaced) {
+    Gameboard board(4, 3, ' ');
+    board.at(1, 1) = '#';
+    board.at(2, 2) = '1';
+    const OverlaySatelliteView view(board, 2, 2, '%');
+    EXPECT_EQ(view.getObjectAt(1, 1), '#');
+    EXPECT_EQ(view.getObjectAt(2, 2), '%');
+    EXPECT_EQ(view.getObjectAt(0, 0), ' ');
+    EXPECT_EQ(view.getObjectAt(4, 0), '&'); // Outside the board
+    EXPECT_EQ(view.getObjectAt(0, 3), '&');
+
+    board.at(1, 1) = '@'; // The view reads the board, it holds no copy
+    EXPECT_EQ(view.getObjectAt(1, 1), '@');
+}
+
+// A player that keeps its own board and re-reads only the changed cells of every DeltaSatelliteView
+// holds the board a full read of the view gives, turn after turn (serial and parallel callbacks)
+TEST_F(GameManagerTest, DeltaViews_PatchedBoardMatchesAFullRead) {
+    struct DeltaReader {
+        std::vector<std::string> board; // Kept between views
+        size_t patched = 0; // Views applied as changes
+        size_t cellsRead = 0;
+
+        void read(SatelliteView& view, const TestMap& map) {
+            const auto* delta = dynamic_cast<const DeltaSatelliteView*>(&view);
+            ASSERT_NE(delta, nullptr);
+            std::vector<std::string> full(map.height(), std::string(map.width(), ' '));
+            for (size_t y = 0; y < map.height(); ++y) {
+                for (size_t x = 0; x < map.width(); ++x) full[y][x] = view.getObjectAt(x, y);
+            }
+
+            if (delta->hasChanges()) {
+                ASSERT_EQ(board.size(), map.height());
+                ASSERT_EQ(delta->getWidth(), map.width());
+                for (const size_t cell : delta->getChangedCells()) {
+                    board[cell / map.width()][cell % map.width()] = view.getObjectAt(cell % map.width(), cell / map.width());
+                }
+                ++patched;
+                cellsRead += delta->getChangedCells().size();
+            }
+            else {
+                board = full;
+                cellsRead += map.width() * map.height();
+            }
+            EXPECT_EQ(board, full);
+        }
+    };
+
+    for (const size_t threads : {1, 3}) {
+        for (const auto& map : testMaps()) {
+            for (uint32_t seed = 1; seed <= 4; ++seed) {
+                SCOPED_TRACE(map.name + " seed " + std::to_string(seed) + " threads " + std::to_string(threads));
+                GM_209277367_322542887 gm(false);
+                gm.setCallbackThreads(threads);
+                ScriptedGame game(seed);
+                std::array<DeltaReader, 2> readers;
+                game.player1.check = [&](SatelliteView& view) { readers[0].read(view, map); };
+                game.player2.check = [&](SatelliteView& view) { readers[1].read(view, map); };
+                game.run(gm, map);
+
+                const size_t views = game.player1.count + game.player2.count;
+                ASSERT_GT(views, 2u);
+                EXPECT_GT(readers[0].patched + readers[1].patched, 0u); // Only the first view of each player is read in full
+                EXPECT_LT(readers[0].cellsRead + readers[1].cellsRead, views * map.width() * map.height());
+            }
+        }
+    }
+}
+
+// ===================== Zobrist hash =====================
+
+TEST_F(GameManagerTest, StateHash_MatchesRecomputeAfterEveryTurn) {
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            game.start(gm, map);
+            EXPECT_EQ(gm.getStateHash(), gm.computeStateHash());
+            bool running = true;
+            while (running) {
+                running = gm.playTurn();
+                ASSERT_EQ(gm.getStateHash(), gm.computeStateHash()) << "turn " << gm.getTurn();
+            }
+        }
+    }
+}
+
+
+// ===================== Cycle detection =====================
+
+// Tanks that only turn around repeat the same 12 turns until max steps
+TEST_F(GameManagerTest, CycleDetection_EndsTheGameAsATie) {
+    const TestMap& map = testMaps().front();
+    const std::vector<ActionRequest> pattern = {ActionRequest::RotateRight45, ActionRequest::GetBattleInfo,
+        ActionRequest::RotateRight45};
+    InTempDir in_temp_dir;
+
+    auto play = [&](size_t cycle_window, int& turns, std::string& log) {
+        GameResult result;
+        {
+            GM_209277367_322542887 gm(true);
+            gm.setCycleWindow(cycle_window);
+            ScriptedGame game(pattern);
+            result = game.run(gm, map);
+            turns = gm.getTurn();
+        } // Destroying the GM writes out its log
+        log = readLog(map);
+        return result;
+    };
+
+    int full_turns = 0, cycle_turns = 0;
+    std::string full_log, cycle_log;
+    play(0, full_turns, full_log);
+    const GameResult ended = play(64, cycle_turns, cycle_log);
+
+    EXPECT_EQ(full_turns, static_cast<int>(map.maxSteps)); // Without detection the game runs out of steps
+    EXPECT_LT(cycle_turns, full_turns / 4);
+    EXPECT_EQ(ended.winner, 0);
+    EXPECT_EQ(ended.reason, GameResult::MAX_STEPS);
+    EXPECT_EQ(ended.rounds, static_cast<size_t>(cycle_turns));
+    EXPECT_LT(ended.rounds, map.maxSteps);
+    EXPECT_EQ(ended.remaining_tanks, (std::vector<size_t>{2, 2}));
+    ASSERT_NE(ended.gameState, nullptr);
+
+    // The turns played are logged as in the full game, then the cycle ending
+    ASSERT_FALSE(cycle_log.empty());
+    const size_t last_line = cycle_log.rfind('\n', cycle_log.size() - 2) + 1;
+    EXPECT_EQ(full_log.compare(0, last_line, cycle_log, 0, last_line), 0);
+    EXPECT_EQ(cycle_log.compare(last_line, std::string::npos, "Tie, the game repeats every 12 steps, player 1 has 2 tanks, player 2 has 2 tanks\n"), 0)
+        << cycle_log.substr(last_line);
+}
+
+// ===================== Bit-plane shell backend =====================
+
+// The bit planes, with MIN_SHELLS lowered to 1 so they resolve every half step they can, leave
+// exactly what moveShells() / checkShellsCollide() do
+TEST_F(GameManagerTest, ShellBitboard_MatchesSequentialRules) {
+    expectSameTurns({
+        {"sequential", [](GM_209277367_322542887& gm) { gm.openShellKernel_ = false; }},
+        {"bit planes", [](GM_209277367_322542887& gm) {
+            gm.openShellKernel_ = false;
+            gm.setShellBitboard(true);
+            gm.shellBitboardMinShells_ = 1;
+        }},
+    });
+}
+
+// ===================== Phase timings =====================
+
+// The test build defines GM_209277367_322542887_PROFILE: every phase of a verbose game with
+// battle info requests gets time, and the phases add up to no more than the game took
+TEST_F(GameManagerTest, PhaseTimings_AreFilledInAndAddUp) {
+    using Clock = std::chrono::steady_clock;
+    InTempDir in_temp_dir;
+    GM_209277367_322542887 gm(true);
+    for (const auto& map : testMaps()) {
+        SCOPED_TRACE(map.name);
+        ScriptedGame game(1);
+        const Clock::time_point start = Clock::now();
+        game.run(gm, map);
+        const auto took = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        ASSERT_GT(game.player1.count + game.player2.count, 0u);
+
+        const ExtGameResult& ext = gm.getExtGameResult();
+        EXPECT_TRUE(ext.timed);
+        uint64_t sum = 0;
+        for (size_t phase = 0; phase < ExtGameResult::PHASE_COUNT; ++phase) {
+            EXPECT_GT(ext.phaseNanoseconds[phase], 0u) << ExtGameResult::phaseNames[phase];
+            sum += ext.phaseNanoseconds[phase];
+        }
+        EXPECT_EQ(ext.totalNanoseconds(), sum);
+        EXPECT_LE(sum, took); // Timings of this game only, not accumulated over the earlier ones
+    }
+}
+
+// ===================== Time budgets =====================
+
+// Does nothing, at no cost
+class StillTank final : public TankAlgorithm {
+public:
+    ActionRequest getAction() override { return ActionRequest::DoNothing; }
+    void updateBattleInfo(BattleInfo&) override {}
+};
+
+// Burns CPU for a while in every getAction() call
+class SlowTank final : public TankAlgorithm {
+    uint64_t spinNanoseconds_;
+public:
+    explicit SlowTank(std::chrono::nanoseconds spin) : spinNanoseconds_(spin.count()) {}
+    ActionRequest getAction() override {
+        const uint64_t start = GameManager_209277367_322542887::threadCpuNanoseconds();
+        while (GameManager_209277367_322542887::threadCpuNanoseconds() - start < spinNanoseconds_) {}
+        return ActionRequest::RotateLeft45;
+    }
+    void updateBattleInfo(BattleInfo&) override {}
+};
+
+// Blocks in getAction() until the test releases it, and says when it is destroyed
+struct HangGate {
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool released = false;
+    bool destroyed = false;
+};
+
+class HangingTank final : public TankAlgorithm {
+    std::shared_ptr<HangGate> gate_;
+public:
+    explicit HangingTank(std::shared_ptr<HangGate> gate) : gate_(std::move(gate)) {}
+    ~HangingTank() override {
+        std::lock_guard lock(gate_->mutex);
+        gate_->destroyed = true;
+        gate_->changed.notify_all();
+    }
+    ActionRequest getAction() override {
+        std::unique_lock lock(gate_->mutex);
+        gate_->changed.wait(lock, [this] { return gate_->released; });
+        return ActionRequest::DoNothing;
+    }
+    void updateBattleInfo(BattleInfo&) override {}
+};
+
+static TankAlgorithmFactory stillTanks() {
+    return [](int, int) -> std::unique_ptr<TankAlgorithm> { return std::make_unique<StillTank>(); };
+}
+
+// Player 1 spends 2 ms of CPU per call against a 5 ms game budget: it forfeits within a few turns
+TEST_F(GameManagerTest, Budget_SlowAlgorithmForfeitsTheGame) {
+    const TestMap& map = testMaps().back();
+    const auto view = map.view();
+    InTempDir in_temp_dir;
+
+    GameResult result;
+    ExtGameResult ext;
+    {
+        GM_209277367_322542887 gm(true);
+        gm.setActionBudget(0, 5, 0);
+        IdlePlayer player1, player2;
+        result = gm.run(map.width(), map.height(), *view, map.name, map.maxSteps, map.numShells, player1, "slow",
+            player2, "still", [](int, int) -> std::unique_ptr<TankAlgorithm> {
+                return std::make_unique<SlowTank>(std::chrono::milliseconds(2)); }, stillTanks());
+        ext = gm.getExtGameResult();
+    }
+    const std::string log = readLog(map, "slow", "still");
+
+    EXPECT_EQ(result.winner, 2);
+    EXPECT_EQ(result.reason, GameResult::ALL_TANKS_DEAD);
+    EXPECT_LT(result.rounds, 5u);
+    ASSERT_EQ(result.remaining_tanks.size(), 2u);
+    EXPECT_EQ(result.remaining_tanks[0], 0u); // Forfeited
+    EXPECT_GT(result.remaining_tanks[1], 0u);
+    EXPECT_TRUE(ext.budgeted);
+    EXPECT_TRUE(ext.forfeited[0]);
+    EXPECT_FALSE(ext.forfeited[1]);
+    EXPECT_GT(ext.actionCpuNanoseconds[0], 5'000'000u);
+    EXPECT_EQ(ext.timedOutCalls[0], 0u);
+    EXPECT_NE(log.find("Player 2 won, player 1 forfeited (over its time budget)\n"), std::string::npos) << log;
+}
+
+// A getAction() call that never returns is abandoned after the time limit, serially and in parallel
+TEST_F(GameManagerTest, Timeout_HangingAlgorithmIsAbandoned) {
+    const TestMap& map = testMaps().back();
+    const auto view = map.view();
+    for (const size_t threads : {1, 3}) {
+        SCOPED_TRACE("callback threads " + std::to_string(threads));
+        const auto gate = std::make_shared<HangGate>();
+        bool hung = false; // Only player 2's first tank hangs
+        GameResult result;
+        ExtGameResult ext;
+        {
+            GM_209277367_322542887 gm(false);
+            gm.setCallbackThreads(threads);
+            gm.setActionBudget(0, 0, 50);
+            IdlePlayer player1, player2;
+            result = gm.run(map.width(), map.height(), *view, map.name, map.maxSteps, map.numShells, player1, "still",
+                player2, "hanging", stillTanks(), [&](int, int) -> std::unique_ptr<TankAlgorithm> {
+                    if (std::exchange(hung, true)) return std::make_unique<StillTank>();
+                    return std::make_unique<HangingTank>(gate);
+                });
+            ext = gm.getExtGameResult();
+        } // The abandoned call outlives the GM
+
+        EXPECT_EQ(result.winner, 1);
+        EXPECT_EQ(result.rounds, 0u); // Over on the first turn
+        ASSERT_EQ(result.remaining_tanks.size(), 2u);
+        EXPECT_EQ(result.remaining_tanks[1], 0u);
+        EXPECT_TRUE(ext.forfeited[1]);
+        EXPECT_EQ(ext.timedOutCalls[1], 1u);
+        EXPECT_EQ(ext.timedOutCalls[0], 0u);
+
+        // Once released, the abandoned call returns and its algorithm is destroyed
+        std::unique_lock lock(gate->mutex);
+        EXPECT_FALSE(gate->destroyed);
+        gate->released = true;
+        gate->changed.notify_all();
+        EXPECT_TRUE(gate->changed.wait_for(lock, std::chrono::seconds(10), [&] { return gate->destroyed; }));
+    }
+}
+
+// ===================== Reuse across games =====================
+
+// One GM plays every map after reset() cut a game on another map short - with shells in flight
+// or with the no-ammo timer running - and must play it exactly like a new instance
+TEST_F(GameManagerTest, Reset_ReusedGMPlaysLikeFreshInstances) {
+    const auto& maps = testMaps();
+    std::vector<std::unique_ptr<ScriptedGame>> games; // Outlive the GM's tanks
+    GM_209277367_322542887 reused(false);
+
+    for (size_t i = 0; i < maps.size(); ++i) {
+        for (const bool out_of_ammo : {false, true}) {
+            const TestMap& next = maps[(i + 1) % maps.size()];
+            SCOPED_TRACE(maps[i].name + " then " + next.name + (out_of_ammo ? " (out of ammo)" : ""));
+            const uint32_t seed = static_cast<uint32_t>(i + 1);
+
+            // Cut a game on the other map short, once a shell is in flight
+            TestMap cut = maps[i];
+            if (out_of_ammo) cut.numShells = 0;
+            games.emplace_back(std::make_unique<ScriptedGame>(seed + 10))->start(reused, cut);
+            while ((reused.getTurn() < 8 || (!out_of_ammo && reused.shells_.empty())) && reused.playTurn()) {}
+            ASSERT_FALSE(reused.isGameOver());
+            ASSERT_EQ(reused.shells_.empty(), out_of_ammo);
+            EXPECT_EQ(reused.noAmmoFlag_, out_of_ammo);
+            reused.reset();
+            EXPECT_EQ(reused.getTurn(), 0);
+            EXPECT_FALSE(reused.noAmmoFlag_);
+            EXPECT_EQ(reused.noAmmoTimer_, 0u);
+            EXPECT_EQ(reused.shells_.slots(), 0);
+
+            auto& game = *games.emplace_back(std::make_unique<ScriptedGame>(seed));
+            game.start(reused, next);
+            const std::vector<TurnState> turns = playToEnd(reused);
+            const GameResult result = reused.finishGame();
+            EXPECT_EQ(reused.getGameboard().size(), next.width() * next.height()); // Kept its storage
+
+            GM_209277367_322542887 fresh(false);
+            ScriptedGame fresh_game(seed);
+            fresh_game.start(fresh, next);
+            EXPECT_EQ(turns, playToEnd(fresh));
+            EXPECT_EQ(reused.getTurn(), fresh.getTurn());
+            expectSameResult(result, fresh.finishGame());
+        }
+    }
+}
+
+// ===================== Verbose and silent turn loops =====================
+
+// playTurn<false> only leaves the logging out: a silent game goes through the same states as a
+// verbose one, tank bookkeeping included, and ends with the same result
+TEST_F(GameManagerTest, SilentTurns_PlayLikeVerboseTurns) {
+    InTempDir in_temp_dir;
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 3; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 verbose(true), silent(false);
+            ScriptedGame verbose_game(seed), silent_game(seed);
+            verbose_game.start(verbose, map);
+            silent_game.start(silent, map);
+
+            bool running = true;
+            while (running) {
+                running = verbose.playTurn();
+                SCOPED_TRACE("turn " + std::to_string(verbose.getTurn()));
+                ASSERT_EQ(silent.playTurn(), running);
+                ASSERT_EQ(stateOf(silent), stateOf(verbose));
+                ASSERT_EQ(silent.tanks_.getState(), verbose.tanks_.getState());
+                ASSERT_EQ(silent.aliveTanks_, verbose.aliveTanks_);
+                ASSERT_EQ(silent.outOfAmmoTanks_, verbose.outOfAmmoTanks_);
+                ASSERT_EQ(silent.numTanks1_, verbose.numTanks1_);
+                ASSERT_EQ(silent.numTanks2_, verbose.numTanks2_);
+                ASSERT_EQ(silent.gameOverStatus_, verbose.gameOverStatus_);
+            }
+            expectSameResult(silent.finishGame(), verbose.finishGame());
+        }
+    }
+}
+
+// ===================== Tank table =====================
+
+// Between turns live() lists exactly the alive tanks, in increasing order, with the dead ones off
+// the board and the per-player counters in agreement - also after restoring an earlier turn
+TEST_F(GameManagerTest, TankTable_LiveListTracksKills) {
+    size_t killed = 0;
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            GM_209277367_322542887 gm(false);
+            ScriptedGame game(seed);
+            game.start(gm, map);
+            const TankTable& tanks = gm.tanks_;
+
+            const auto check = [&] {
+                std::vector<int> alive;
+                std::array<size_t, 2> per_player{};
+                for (int index = 0; index < tanks.size(); ++index) {
+                    if (tanks.getIsAlive(index) != 0) {
+                        EXPECT_EQ(tanks.getLocation(index), (std::pair<int, int>{-1, -1}));
+                        continue;
+                    }
+                    alive.push_back(index);
+                    ++per_player[tanks.getPlayerId(index) - 1];
+                }
+                ASSERT_EQ(tanks.live(), alive) << "turn " << gm.getTurn();
+                ASSERT_EQ(gm.aliveTanks_, per_player) << "turn " << gm.getTurn();
+            };
+
+            check();
+            GameState saved;
+            std::vector<int> live_at_save;
+            while (gm.playTurn()) {
+                check();
+                if (gm.getTurn() == 5) {
+                    gm.saveState(saved);
+                    live_at_save = tanks.live();
+                }
+            }
+            check();
+            killed += tanks.size() - tanks.live().size();
+
+            if (live_at_save.empty()) continue; // Over before the save
+            ASSERT_TRUE(gm.restoreState(saved));
+            EXPECT_EQ(tanks.live(), live_at_save);
+            check();
+        }
+    }
+    EXPECT_GT(killed, 0u);
+}
+
+// ===================== Fused shell kernel =====================
+
+// The fused open-space kernel, alone and with the bit planes, leaves exactly what
+// moveShells() / checkShellsCollide() do
+TEST_F(GameManagerTest, FusedShellKernel_MatchesSequentialRules) {
+    expectSameTurns({
+        {"sequential", [](GM_209277367_322542887& gm) { gm.openShellKernel_ = false; }},
+        {"fused kernel", [](GM_209277367_322542887&) {}},
+        {"fused kernel and bit planes", [](GM_209277367_322542887& gm) {
+            gm.setShellBitboard(true);
+            gm.shellBitboardMinShells_ = 1;
+        }},
+    });
+}
+
+// ===================== Final board =====================
+
+// The final board is handed over through BoardExporter in bulk, equal to reading it cell by cell
+TEST_F(GameManagerTest, FinalBoard_ExportsTheRowsGetObjectAtReads) {
+    GM_209277367_322542887 gm(false);
+    for (const auto& map : testMaps()) {
+        SCOPED_TRACE(map.name);
+        ScriptedGame game(1);
+        const GameResult result = game.run(gm, map);
+        const auto* exporter = dynamic_cast<const BoardExporter*>(result.gameState.get());
+        ASSERT_NE(exporter, nullptr);
+
+        std::vector<std::vector<char>> rows;
+        EXPECT_FALSE(exporter->exportRows(map.width() + 1, map.height(), rows)); // Another size
+        ASSERT_TRUE(exporter->exportRows(map.width(), map.height(), rows));
+        ASSERT_EQ(rows.size(), map.height());
+        for (size_t y = 0; y < map.height(); ++y) {
+            ASSERT_EQ(rows[y].size(), map.width());
+            for (size_t x = 0; x < map.width(); ++x) EXPECT_EQ(rows[y][x], result.gameState->getObjectAt(x, y));
+        }
+    }
+}
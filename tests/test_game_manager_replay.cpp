@@ -0,0 +1,136 @@
+// tests/test_game_manager_replay.cpp
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "./utils/gm_utils.test.cpp"
+
+using GameManager_209277367_322542887::Replay;
+using GameManager_209277367_322542887::ReplayEngine;
+
+namespace {
+
+// Header offsets of the u32 tank count and turn count (see ReplayFormat.h)
+constexpr size_t TANK_COUNT_OFFSET = 21;
+constexpr size_t TURNS_OFFSET = 25;
+
+void putU32(std::string& bytes, size_t offset, uint32_t value) {
+    for (int i = 0; i < 4; ++i) bytes[offset + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+}
+
+} // namespace
+
+// ---------- Fixture ----------
+class GameManagerReplayTest : public ::testing::Test {
+protected:
+    TempDir dir;
+
+    // Plays a scripted game with recording on, returns its result and final hash
+    std::pair<GameResult, uint64_t> record(const TestMap& map, uint32_t seed, const fs::path& file) {
+        GM_209277367_322542887 gm(false);
+        gm.setReplayFile(file.string());
+        ScriptedGame game(seed);
+        GameResult result = game.run(gm, map);
+        return {std::move(result), gm.getStateHash()};
+    }
+
+    static std::string readBytes(const fs::path& file) {
+        std::ifstream in(file, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+};
+
+// ===================== Record and replay =====================
+
+TEST_F(GameManagerReplayTest, RecordedGame_ReplaysToSameResultAndBoard) {
+    for (const auto& map : testMaps()) {
+        for (uint32_t seed = 1; seed <= 3; ++seed) {
+            SCOPED_TRACE(map.name + " seed " + std::to_string(seed));
+            const fs::path file = dir.path() / (map.name + std::to_string(seed) + ".tkr");
+            const auto [recorded, hash] = record(map, seed, file);
+            ASSERT_NE(recorded.gameState, nullptr); // The scripted games end long before max steps
+
+            Replay replay = Replay::load(file.string());
+            EXPECT_EQ(replay.width, map.width());
+            EXPECT_EQ(replay.height, map.height());
+            EXPECT_EQ(replay.maxSteps, map.maxSteps);
+            EXPECT_EQ(replay.numShells, map.numShells);
+            EXPECT_EQ(replay.mapName, map.name);
+            EXPECT_EQ(replay.name1, "scripted1");
+            EXPECT_EQ(replay.name2, "scripted2");
+            EXPECT_EQ(rowsOf(replay.map), map.rows);
+
+            ReplayEngine engine(std::move(replay));
+            const GameResult replayed = engine.run();
+            expectSameResult(replayed, recorded);
+            EXPECT_EQ(engine.getStateHash(), hash);
+        }
+    }
+}
+
+TEST_F(GameManagerReplayTest, Seek_BackwardsMatchesForwardSteps) {
+    const TestMap& map = testMaps().front();
+    const fs::path file = dir.path() / "seek.tkr";
+    record(map, 11, file); // A long game
+
+    // Board and hash after every turn, stepping forward
+    ReplayEngine engine(Replay::load(file.string()));
+    std::map<size_t, std::pair<std::vector<std::string>, uint64_t>> states;
+    states[engine.getTurn()] = {rowsOf(engine.getGameboard()), engine.getStateHash()};
+    while (engine.step()) states[engine.getTurn()] = {rowsOf(engine.getGameboard()), engine.getStateHash()};
+    const size_t last = engine.getTurn();
+    ASSERT_GT(last, 2u * 64u); // Past two checkpoints
+
+    auto expectStateAt = [&](size_t turn) {
+        SCOPED_TRACE("turn " + std::to_string(turn));
+        engine.seek(turn);
+        EXPECT_EQ(engine.getTurn(), turn);
+        EXPECT_EQ(rowsOf(engine.getGameboard()), states[turn].first);
+        EXPECT_EQ(engine.getStateHash(), states[turn].second);
+    };
+
+    for (size_t turn : {last - 1, last / 2, size_t{129}, size_t{128}, size_t{64}, size_t{63}, size_t{1}, size_t{0}}) {
+        expectStateAt(turn);
+    }
+
+    // Seeking after run() starts over from the checkpoints too
+    engine.run();
+    expectStateAt(last / 2);
+    expectStateAt(last - 1);
+}
+
+// ===================== Malformed files =====================
+
+TEST_F(GameManagerReplayTest, Parse_RejectsMalformedFiles) {
+    const fs::path file = dir.path() / "valid.tkr";
+    record(testMaps().front(), 3, file);
+    const std::string valid = readBytes(file);
+    ASSERT_NO_THROW(Replay::parse(valid));
+
+    std::string bad_magic = valid;
+    bad_magic[0] = 'X';
+    EXPECT_THROW(Replay::parse(bad_magic), std::runtime_error);
+
+    EXPECT_THROW(Replay::parse(valid.substr(0, TURNS_OFFSET)), std::runtime_error); // Cut in the header
+    EXPECT_THROW(Replay::parse(valid.substr(0, valid.size() - 2)), std::runtime_error); // Cut in the turns
+
+    std::string many_tanks = valid;
+    putU32(many_tanks, TANK_COUNT_OFFSET, 0xFFFFFFFFu);
+    EXPECT_THROW(Replay::parse(many_tanks), std::runtime_error);
+
+    std::string many_turns = valid;
+    putU32(many_turns, TURNS_OFFSET, 0xFFFFFFFFu);
+    EXPECT_THROW(Replay::parse(many_turns), std::runtime_error);
+
+    std::string no_tanks = valid;
+    putU32(no_tanks, TANK_COUNT_OFFSET, 0);
+    putU32(no_tanks, TURNS_OFFSET, 0xFFFFFFFFu);
+    EXPECT_THROW(Replay::parse(no_tanks), std::runtime_error);
+
+    EXPECT_THROW(Replay::load((dir.path() / "missing.tkr").string()), std::runtime_error);
+}
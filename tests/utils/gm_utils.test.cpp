@@ -0,0 +1,236 @@
+// tests/utils/gm_utils.test.cpp - shared by the GameManager tests (test_game_manager*)
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "./utils.test.cpp"
+
+#include "GameManagerRegistration.h"
+#include "ExtSatelliteView.h"
+
+// --- test-only access to internals ---
+#define private public
+#define protected public
+#include "GM_209277367_322542887.h"
+#include "ReplayEngine.h"
+#undef private
+#undef protected
+
+using GameManager_209277367_322542887::GM_209277367_322542887;
+using UserCommon_209277367_322542887::ExtSatelliteView;
+using UserCommon_209277367_322542887::Gameboard;
+
+// The GameManager registers itself with REGISTER_GAME_MANAGER; these tests build it in and
+// create it directly, so there is no registrar to add it to
+GameManagerRegistration::GameManagerRegistration(GameManagerFactory) {}
+
+// ---------- Maps ----------
+
+struct TestMap {
+    std::string name;
+    std::vector<std::string> rows;
+    size_t maxSteps;
+    size_t numShells;
+
+    size_t width() const { return rows.front().size(); }
+    size_t height() const { return rows.size(); }
+    std::unique_ptr<ExtSatelliteView> view() const {
+        std::vector<std::vector<char>> cells;
+        for (const auto& row : rows) cells.emplace_back(row.begin(), row.end());
+        return std::make_unique<ExtSatelliteView>(width(), height(), cells);
+    }
+};
+
+// Walls and mines in corridors, shells in open space, and a crowded arena
+static const std::vector<TestMap>& testMaps() {
+    static const std::vector<TestMap> maps = {
+        {"maze", {
+            "############",
+            "#1  #  @ 2 #",
+            "# ## # ## ##",
+            "#    #     #",
+            "## ####### #",
+            "#  @   #   #",
+            "# ## #   # #",
+            "#   # ###  #",
+            "#2 @ # 1   #",
+            "# ### ##### ",
+            "#     @     ",
+            "############"}, 400, 8},
+        {"open", {
+            "                ",
+            "  1     @    2  ",
+            "                ",
+            "     @      1   ",
+            "  2             ",
+            "          @     ",
+            "   1        2   ",
+            "                ",
+            "       @        ",
+            "  2          1  "}, 400, 10},
+        {"arena", {
+            "##########",
+            "#1  2 1 2#",
+            "#  #  @  #",
+            "# @  ##  #",
+            "#  ##  @ #",
+            "#  @  #  #",
+            "#2 1 2  1#",
+            "##########"}, 400, 6},
+    };
+    return maps;
+}
+
+// ---------- Scripted players ----------
+
+// Plays a fixed script, then does nothing
+class ScriptedTank final : public TankAlgorithm {
+    const std::vector<ActionRequest>& script_;
+    size_t& next_;
+
+public:
+    ScriptedTank(const std::vector<ActionRequest>& script, size_t& next) : script_(script), next_(next) {}
+    ActionRequest getAction() override { return next_ < script_.size() ? script_[next_++] : ActionRequest::DoNothing; }
+    void updateBattleInfo(BattleInfo&) override {}
+};
+
+class IdlePlayer final : public Player {
+public:
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView&) override {}
+};
+
+// FNV-1a, for comparing boards, logs and battle info views with recorded values
+static constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+static uint64_t fnv1a(const uint64_t hash, const char c) { return (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull; }
+static uint64_t fnv1a(const std::string& bytes) {
+    uint64_t hash = FNV_OFFSET;
+    for (const char c : bytes) hash = fnv1a(hash, c);
+    return hash;
+}
+
+// Hashes every battle info view it gets, cell by cell, and hands the view to check if set
+class ViewPlayer final : public Player {
+public:
+    size_t width = 0; // Of the board, set by ScriptedGame
+    size_t height = 0;
+    uint64_t views = FNV_OFFSET;
+    size_t count = 0; // Views received
+    std::function<void(SatelliteView&)> check;
+
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView& view) override {
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) views = fnv1a(views, view.getObjectAt(x, y));
+        }
+        ++count;
+        if (check) check(view);
+    }
+};
+
+// Calls check once per turn, from the first getAction() call of the turn - after the previous
+// turn ended and before any action of this one. Serial games only.
+struct TurnWatch {
+    const GM_209277367_322542887* gm = nullptr;
+    std::function<void()> check;
+    int lastTurn = -1;
+
+    void atTurnStart() {
+        if (gm->turn_ == lastTurn) return;
+        lastTurn = gm->turn_;
+        check();
+    }
+};
+
+class WatchedTank final : public TankAlgorithm {
+    std::unique_ptr<TankAlgorithm> tank_;
+    TurnWatch& watch_;
+
+public:
+    WatchedTank(std::unique_ptr<TankAlgorithm> tank, TurnWatch& watch) : tank_(std::move(tank)), watch_(watch) {}
+    ActionRequest getAction() override {
+        watch_.atTurnStart();
+        return tank_->getAction();
+    }
+    void updateBattleInfo(BattleInfo& info) override { tank_->updateBattleInfo(info); }
+};
+
+// One game of random scripts (or of one repeated pattern): the tanks get their scripts in the
+// order the GM creates them, and the cursors live here, so a test can rewind the tanks together
+// with a saved game state
+class ScriptedGame {
+    uint32_t seed_;
+    std::vector<ActionRequest> pattern_;
+    std::deque<std::vector<ActionRequest>> scripts_;
+
+public:
+    std::deque<size_t> cursors;
+    ViewPlayer player1;
+    ViewPlayer player2;
+    TurnWatch* watch = nullptr; // Watches the turns of the tanks created from then on
+
+    explicit ScriptedGame(uint32_t seed) : seed_(seed) {}
+    explicit ScriptedGame(std::vector<ActionRequest> pattern) : seed_(0), pattern_(std::move(pattern)) {}
+    ScriptedGame(const ScriptedGame&) = delete; // The factories point into it
+    ScriptedGame& operator=(const ScriptedGame&) = delete;
+
+    const std::deque<std::vector<ActionRequest>>& scripts() const { return scripts_; } // In tank creation order
+
+    TankAlgorithmFactory factory(size_t length) {
+        return [this, length](int, int) -> std::unique_ptr<TankAlgorithm> {
+            std::mt19937 rng(seed_ * 1000003u + static_cast<uint32_t>(scripts_.size()));
+            auto& script = scripts_.emplace_back();
+            for (size_t i = 0; i < length; ++i) {
+                script.push_back(pattern_.empty() ? static_cast<ActionRequest>(rng() % 9) : pattern_[i % pattern_.size()]);
+            }
+            auto tank = std::make_unique<ScriptedTank>(script, cursors.emplace_back(0));
+            if (watch == nullptr) return tank;
+            return std::make_unique<WatchedTank>(std::move(tank), *watch);
+        };
+    }
+
+    void setBoardSize(const TestMap& map) {
+        for (auto* player : {&player1, &player2}) {
+            player->width = map.width();
+            player->height = map.height();
+        }
+    }
+
+    void start(GM_209277367_322542887& gm, const TestMap& map) {
+        setBoardSize(map);
+        const auto view = map.view();
+        gm.startGame(map.width(), map.height(), *view, map.name, map.maxSteps, map.numShells,
+            player1, "scripted1", player2, "scripted2", factory(map.maxSteps), factory(map.maxSteps));
+    }
+
+    GameResult run(GM_209277367_322542887& gm, const TestMap& map) {
+        setBoardSize(map);
+        const auto view = map.view();
+        return gm.run(map.width(), map.height(), *view, map.name, map.maxSteps, map.numShells,
+            player1, "scripted1", player2, "scripted2", factory(map.maxSteps), factory(map.maxSteps));
+    }
+};
+
+// ---------- Comparisons ----------
+
+static std::vector<std::string> rowsOf(const Gameboard& board) {
+    std::vector<std::string> out;
+    for (int y = 0; y < board.getHeight(); ++y) out.emplace_back(board.row(y), board.getWidth());
+    return out;
+}
+
+static std::vector<std::string> rowsOf(const GameResult& result) {
+    const auto* view = dynamic_cast<const ExtSatelliteView*>(result.gameState.get());
+    return view ? rowsOf(view->getBoard()) : std::vector<std::string>{};
+}
+
+static void expectSameResult(const GameResult& actual, const GameResult& expected) {
+    EXPECT_EQ(actual.winner, expected.winner);
+    EXPECT_EQ(actual.reason, expected.reason);
+    EXPECT_EQ(actual.rounds, expected.rounds);
+    EXPECT_EQ(actual.remaining_tanks, expected.remaining_tanks);
+    EXPECT_EQ(rowsOf(actual), rowsOf(expected));
+}